@@ -0,0 +1,480 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// runtime.cpp: Microbenchmarks of the runtime components
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// Build and run, from the repository root:
+//     g++ -std=c++11 -O2 -Iinclude benchmarks/runtime.cpp -o runtime
+//     ./runtime [--json] [filter]
+// Defining JTC_TRACE also measures the cost of a tracing probe.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "jtc/jtc.hpp"
+#include "jtc/templates/benchmark.hpp"
+
+namespace {
+
+using jtc::bench::do_not_optimize;
+
+//-------------------------------------------------------------------------------------------------
+// Move and forward
+//
+// A type owning a heap buffer, so a copy costs an allocation and a copy, and a move costs two stores.
+//-------------------------------------------------------------------------------------------------
+
+class buffer {
+ public:
+  explicit buffer(jtc::size_t size) : data_(new unsigned char[size]), size_(size) { memset(data_, 0, size); }
+  buffer(const buffer& other) : data_(new unsigned char[other.size_]), size_(other.size_) {
+    memcpy(data_, other.data_, size_);
+  }
+  buffer(buffer&& other) noexcept : data_(other.data_), size_(other.size_) {
+    other.data_ = nullptr;
+    other.size_ = 0;
+  }
+  buffer& operator=(buffer other) noexcept {
+    unsigned char* data = data_;
+    data_ = other.data_;
+    other.data_ = data;
+    const jtc::size_t size = size_;
+    size_ = other.size_;
+    other.size_ = size;
+    return *this;
+  }
+  ~buffer() { delete[] data_; }
+
+  jtc::size_t size() const { return size_; }
+
+ private:
+  unsigned char* data_;
+  jtc::size_t size_;
+};
+
+void swap_copy(buffer& a, buffer& b) {
+  buffer t(a);
+  a = b;
+  b = t;
+}
+
+void swap_move(buffer& a, buffer& b) {
+  buffer t(jtc::move(a));
+  a = jtc::move(b);
+  b = jtc::move(t);
+}
+
+/// Passes its argument on to a constructor, as emplace-style functions do
+template <typename T, typename Arg>
+T make_forwarded(Arg&& arg) {
+  return T(jtc::forward<Arg>(arg));
+}
+
+/// Passes its argument on without forwarding, always copying
+template <typename T, typename Arg>
+T make_copied(Arg&& arg) {
+  return T(arg);
+}
+
+void move_forward_benchmarks(jtc::bench::runner& r) {
+  buffer a(256), b(256);
+  r.run("swap/copy/256", [&] {
+    swap_copy(a, b);
+    do_not_optimize(a);
+  });
+  r.run("swap/move/256", [&] {
+    swap_move(a, b);
+    do_not_optimize(a);
+  });
+
+  r.run("pass_rvalue/copy/256", [&] {
+    buffer result = make_copied<buffer>(buffer(256));
+    do_not_optimize(result);
+  });
+  r.run("pass_rvalue/forward/256", [&] {
+    buffer result = make_forwarded<buffer>(buffer(256));
+    do_not_optimize(result);
+  });
+}
+
+//-------------------------------------------------------------------------------------------------
+// Memory
+//-------------------------------------------------------------------------------------------------
+
+struct message {
+  jtc::uint32_t id;
+  jtc::uint32_t size;
+  unsigned char payload[56];
+
+  message(jtc::uint32_t id_, jtc::uint32_t size_) : id(id_), size(size_) {}
+};
+
+/// A std::any-like value, allocating every value on the heap: the baseline of inplace_any
+class heap_any {
+  struct holder_base {
+    virtual ~holder_base() {}
+    virtual holder_base* clone() const = 0;
+  };
+
+  template <typename T>
+  struct holder : holder_base {
+    explicit holder(const T& value_) : value(value_) {}
+    holder_base* clone() const override { return new holder(value); }
+    T value;
+  };
+
+ public:
+  template <typename T>
+  explicit heap_any(const T& value) : holder_(new holder<T>(value)) {}
+  heap_any(const heap_any& other) : holder_(other.holder_ != nullptr ? other.holder_->clone() : nullptr) {}
+  heap_any(heap_any&& other) noexcept : holder_(other.holder_) { other.holder_ = nullptr; }
+  heap_any& operator=(heap_any&& other) noexcept {
+    holder_base* holder = holder_;
+    holder_ = other.holder_;
+    other.holder_ = holder;
+    return *this;
+  }
+  ~heap_any() { delete holder_; }
+
+ private:
+  holder_base* holder_;
+};
+
+/// The records of the SoA/AoS sweeps: only x and v are read
+struct particle {
+  float x, v, mass, charge;
+};
+
+void memory_benchmarks(jtc::bench::runner& r) {
+  static jtc::object_pool<message, 64> pool;
+  jtc::uint32_t id = 0;
+  r.run("object_pool/acquire+release", [&] {
+    message* m = pool.acquire(id++, 16u);
+    do_not_optimize(m);
+    pool.release(m);
+  });
+  r.run("new+delete/message", [&] {
+    message* m = new message(id++, 16u);
+    do_not_optimize(m);
+    delete m;
+  });
+
+  static jtc::arena<4096> frame;
+  r.run("arena/make*32+reset", [&] {
+    for (jtc::uint32_t i = 0; i < 32; i++) {
+      message* m = frame.make<message>(i, 16u);
+      do_not_optimize(m);
+    }
+    frame.reset();
+  });
+  r.run("malloc+free*32/message", [&] {
+    message* m[32];
+    for (jtc::uint32_t i = 0; i < 32; i++) {
+      m[i] = jtc::construct_at(static_cast<message*>(malloc(sizeof(message))), i, 16u);
+      do_not_optimize(m[i]);
+    }
+    for (jtc::uint32_t i = 0; i < 32; i++) free(m[i]);
+  });
+
+  using any = jtc::inplace_any<64>;
+  any value = message(1, 2);
+  r.run("inplace_any/copy", [&] {
+    any copy(value);
+    do_not_optimize(copy);
+  });
+  r.run("inplace_any/move", [&] {
+    any moved(jtc::move(value));
+    value = jtc::move(moved);
+    do_not_optimize(value);
+  });
+  heap_any heap_value(message(1, 2));
+  r.run("heap_any/copy", [&] {
+    heap_any copy(heap_value);
+    do_not_optimize(copy);
+  });
+  r.run("heap_any/move", [&] {
+    heap_any moved(jtc::move(heap_value));
+    heap_value = jtc::move(moved);
+    do_not_optimize(heap_value);
+  });
+
+  // Sweeping two fields of 4: SoA reads only their columns, AoS reads whole records
+  static jtc::soa_array<jtc::type_list<float, float, float, float>, 1024> soa;
+  static particle aos[1024];
+  for (jtc::size_t i = 0; i < 1024; i++) {
+    soa.set(i, 0.0f, 1.0f, 2.0f, 3.0f);
+    aos[i] = particle{0.0f, 1.0f, 2.0f, 3.0f};
+  }
+  r.run("soa/field_sweep/1024", [&] {
+    jtc::span<float> x = soa.field<0>();
+    jtc::span<float> v = soa.field<1>();
+    for (jtc::size_t i = 0; i < x.size(); i++) x[i] += v[i];
+    do_not_optimize(soa);
+  });
+  r.run("aos/field_sweep/1024", [&] {
+    for (jtc::size_t i = 0; i < 1024; i++) aos[i].x += aos[i].v;
+    do_not_optimize(aos);
+  });
+}
+
+//-------------------------------------------------------------------------------------------------
+// Binary encodings and sorting
+//
+// Each component is compared to the straightforward code it replaces.
+//-------------------------------------------------------------------------------------------------
+
+/// Byte-at-a-time LEB128 encoding, the baseline of the unrolled varint codec
+unsigned char* naive_varint_encode(jtc::uint64_t value, unsigned char* out) {
+  while (value >= 0x80) {
+    *out++ = static_cast<unsigned char>(value | 0x80);
+    value >>= 7;
+  }
+  *out++ = static_cast<unsigned char>(value);
+  return out;
+}
+
+const unsigned char* naive_varint_decode(const unsigned char* in, const unsigned char* end, jtc::uint64_t& value) {
+  value = 0;
+  for (unsigned shift = 0; in != end && shift < 64; shift += 7) {
+    const unsigned char byte = *in++;
+    value |= static_cast<jtc::uint64_t>(byte & 0x7F) << shift;
+    if (byte < 0x80) return in;
+  }
+  return nullptr;
+}
+
+/// Big-endian load and store with memcpy and a byte swap, the baseline of wire_struct and load_endian
+template <typename T>
+T naive_load_big(const unsigned char* source) {
+  T value;
+  memcpy(&value, source, sizeof(T));
+  return jtc::endian::native == jtc::endian::big ? value : jtc::byteswap(value);
+}
+
+template <typename T>
+void naive_store_big(unsigned char* destination, T value) {
+  if (jtc::endian::native != jtc::endian::big) value = jtc::byteswap(value);
+  memcpy(destination, &value, sizeof(T));
+}
+
+/// Insertion sort, the baseline of network_sort
+template <typename T, jtc::size_t N>
+void insertion_sort(T (&data)[N]) {
+  for (jtc::size_t i = 1; i < N; i++) {
+    const T value = data[i];
+    jtc::size_t j = i;
+    for (; j > 0 && data[j - 1] > value; j--) data[j] = data[j - 1];
+    data[j] = value;
+  }
+}
+
+void binary_benchmarks(jtc::bench::runner& r) {
+  static unsigned char data[4096];
+  for (jtc::size_t i = 0; i < sizeof(data); i++) data[i] = static_cast<unsigned char>(i * 131 + 7);
+
+  r.run("crc32/bytewise/4096", [&] {
+    do_not_optimize(data);
+    do_not_optimize(jtc::crc<jtc::crc32_model>::compute(data, sizeof(data)));
+  });
+  r.run("crc32/slice8/4096", [&] {
+    do_not_optimize(data);
+    do_not_optimize(jtc::crc<jtc::crc32_model>::compute_sliced<8>(data, sizeof(data)));
+  });
+
+  static jtc::uint64_t values[64];
+  static unsigned char encoded[64 * 10];
+  for (jtc::size_t i = 0; i < 64; i++) values[i] = (jtc::uint64_t(1) << (i % 40)) + i;
+  r.run("varint/encode*64", [&] {
+    do_not_optimize(values);
+    do_not_optimize(jtc::varint_encode_n(values, 64, encoded));
+  });
+  const unsigned char* encoded_end = jtc::varint_encode_n(values, 64, encoded);
+  r.run("varint/decode*64", [&] {
+    do_not_optimize(encoded);
+    do_not_optimize(jtc::varint_decode_n(encoded, encoded_end, values, 64));
+  });
+  r.run("naive_varint/encode*64", [&] {
+    do_not_optimize(values);
+    unsigned char* out = encoded;
+    for (jtc::size_t i = 0; i < 64; i++) out = naive_varint_encode(values[i], out);
+    do_not_optimize(out);
+  });
+  r.run("naive_varint/decode*64", [&] {
+    do_not_optimize(encoded);
+    const unsigned char* in = encoded;
+    for (jtc::size_t i = 0; i < 64 && in != nullptr; i++) in = naive_varint_decode(in, encoded_end, values[i]);
+    do_not_optimize(in);
+  });
+
+  // A header: big-endian type and length, little-endian checksum. Each operation reads it, and updates the length.
+  using header = jtc::type_list<jtc::wire_field<jtc::uint16_t, jtc::endian::big>,
+                                jtc::wire_field<jtc::uint32_t, jtc::endian::big>,
+                                jtc::wire_field<jtc::uint32_t, jtc::endian::little>>;
+  static unsigned char packet[10] = {0, 7, 0, 0, 1, 0, 0x78, 0x56, 0x34, 0x12};
+  r.run("wire_struct/get*3+set", [&] {
+    do_not_optimize(packet);
+    const jtc::wire_struct<header> view(packet);
+    view.set<1>(view.get<1>() + view.get<0>() + (view.get<2>() & 1));
+  });
+  r.run("load_endian*3+store_endian", [&] {
+    do_not_optimize(packet);
+    const jtc::uint32_t length = jtc::load_endian<jtc::uint32_t, jtc::endian::big>(packet + 2) +
+                                 jtc::load_endian<jtc::uint16_t, jtc::endian::big>(packet) +
+                                 (jtc::load_endian<jtc::uint32_t, jtc::endian::little>(packet + 6) & 1);
+    jtc::store_endian<jtc::endian::big>(packet + 2, length);
+  });
+  r.run("memcpy+byteswap*3+store", [&] {
+    do_not_optimize(packet);
+    jtc::uint32_t checksum;
+    memcpy(&checksum, packet + 6, sizeof(checksum));
+    if (jtc::endian::native == jtc::endian::big) checksum = jtc::byteswap(checksum);
+    const jtc::uint32_t length =
+        naive_load_big<jtc::uint32_t>(packet + 2) + naive_load_big<jtc::uint16_t>(packet) + (checksum & 1);
+    naive_store_big(packet + 2, length);
+  });
+
+  r.run("network_sort/9", [&] {
+    int window[9] = {7, 3, 9, 1, 5, 8, 2, 6, 4};
+    do_not_optimize(window);
+    jtc::network_sort(window);
+    do_not_optimize(window);
+  });
+  r.run("insertion_sort/9", [&] {
+    int window[9] = {7, 3, 9, 1, 5, 8, 2, 6, 4};
+    do_not_optimize(window);
+    insertion_sort(window);
+    do_not_optimize(window);
+  });
+}
+
+//-------------------------------------------------------------------------------------------------
+// Numeric types
+//
+// fixed_point is compared to float. On hosted targets, float has hardware support, so this shows
+//   the overhead of fixed-point on them. On targets without an FPU, float is emulated and far slower.
+//-------------------------------------------------------------------------------------------------
+
+/// An eager vector, with operators returning temporaries: the baseline of vec's expression templates
+template <jtc::size_t N>
+struct eager_vec {
+  float values[N];
+
+  friend eager_vec operator+(const eager_vec& a, const eager_vec& b) {
+    eager_vec r;
+    for (jtc::size_t i = 0; i < N; i++) r.values[i] = a.values[i] + b.values[i];
+    return r;
+  }
+  friend eager_vec operator-(const eager_vec& a, const eager_vec& b) {
+    eager_vec r;
+    for (jtc::size_t i = 0; i < N; i++) r.values[i] = a.values[i] - b.values[i];
+    return r;
+  }
+  friend eager_vec operator*(const eager_vec& a, float b) {
+    eager_vec r;
+    for (jtc::size_t i = 0; i < N; i++) r.values[i] = a.values[i] * b;
+    return r;
+  }
+};
+
+void numeric_benchmarks(jtc::bench::runner& r) {
+  jtc::int16_t a = 30000, b = 5000;
+  r.run("sat_add/int16", [&] {
+    do_not_optimize(a);
+    do_not_optimize(b);
+    do_not_optimize(jtc::sat_add(a, b));
+  });
+
+  using q16 = jtc::fixed<16, 16>;
+  static q16 fixed_a[64], fixed_b[64];
+  static float float_a[64], float_b[64];
+  for (jtc::size_t i = 0; i < 64; i++) {
+    float_a[i] = 0.5f + static_cast<float>(i % 8) * 0.125f;
+    float_b[i] = 1.5f - static_cast<float>(i % 5) * 0.25f;
+    fixed_a[i] = q16(float_a[i]);
+    fixed_b[i] = q16(float_b[i]);
+  }
+  r.run("fixed_point/q16/dot*64", [&] {
+    do_not_optimize(fixed_a);
+    q16 total;
+    for (jtc::size_t i = 0; i < 64; i++) total = total + fixed_a[i] * fixed_b[i];
+    do_not_optimize(total);
+  });
+  r.run("float/dot*64", [&] {
+    do_not_optimize(float_a);
+    float total = 0;
+    for (jtc::size_t i = 0; i < 64; i++) total += float_a[i] * float_b[i];
+    do_not_optimize(total);
+  });
+
+  // y = x * 2 + y, over 1024 floats. The compiler may vectorize the scalar loop too, depending on flags.
+  using simd8 = jtc::simd<float, 8>;
+  alignas(simd8::alignment) static float x[1024];
+  alignas(simd8::alignment) static float y[1024];
+  for (jtc::size_t i = 0; i < 1024; i++) x[i] = static_cast<float>(i % 13);
+  r.run("simd/saxpy/1024", [&] {
+    memset(y, 0, sizeof(y));
+    const simd8 factor(2.0f);
+    for (jtc::size_t i = 0; i < 1024; i += 8)
+      (simd8::load_aligned(x + i) * factor + simd8::load_aligned(y + i)).store_aligned(y + i);
+    do_not_optimize(y);
+  });
+  r.run("scalar/saxpy/1024", [&] {
+    memset(y, 0, sizeof(y));
+    for (jtc::size_t i = 0; i < 1024; i++) y[i] = x[i] * 2.0f + y[i];
+    do_not_optimize(y);
+  });
+
+  // r = a * 2 + b - c: one loop with expression templates, three loops and temporaries without them
+  jtc::vec<float, 16> va, vb, vc;
+  eager_vec<16> ea, eb, ec;
+  for (jtc::size_t i = 0; i < 16; i++) {
+    va[i] = ea.values[i] = static_cast<float>(i);
+    vb[i] = eb.values[i] = static_cast<float>(i * 3);
+    vc[i] = ec.values[i] = static_cast<float>(16 - i);
+  }
+  r.run("vec/expression/16", [&] {
+    do_not_optimize(va);
+    jtc::vec<float, 16> result = va * 2.0f + vb - vc;
+    do_not_optimize(result);
+  });
+  r.run("eager_vec/temporaries/16", [&] {
+    do_not_optimize(ea);
+    eager_vec<16> result = ea * 2.0f + eb - ec;
+    do_not_optimize(result);
+  });
+}
+
+//-------------------------------------------------------------------------------------------------
+// Instrumentation
+//-------------------------------------------------------------------------------------------------
+
+void trace_benchmarks(jtc::bench::runner& r) {
+  r.run("bench/cycles", [] { do_not_optimize(jtc::bench::cycles()); });
+  r.run("bench/nanoseconds", [] { do_not_optimize(jtc::bench::nanoseconds()); });
+#ifdef JTC_TRACE
+  r.run("trace/scope", [] { JTC_TRACE_SCOPE("benchmark"); });
+#endif
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  bool json = false;
+  jtc::bench::runner r;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--json") == 0) json = true;
+    else r.filter(argv[i]);
+  }
+
+  move_forward_benchmarks(r);
+  memory_benchmarks(r);
+  binary_benchmarks(r);
+  numeric_benchmarks(r);
+  trace_benchmarks(r);
+
+  if (json) r.print_json(stdout);
+  else r.print_table(stdout);
+  return 0;
+}
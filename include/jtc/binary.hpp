@@ -0,0 +1,31 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// binary.hpp: Binary encoding: byte order, wire formats, variable-length integers and bit packing
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_BINARY_HPP
+#define JTC_BINARY_HPP
+
+//-------------------------------------------------------------------------------------------------
+// Byte order
+//-------------------------------------------------------------------------------------------------
+
+// Emulates C++20's endian and C++23's byteswap, plus unaligned loads and stores in a given byte order
+#include "templates/endian.hpp"
+
+//-------------------------------------------------------------------------------------------------
+// Wire formats
+//-------------------------------------------------------------------------------------------------
+
+// Zero-copy views of packed records, with compile-time offsets and per-field byte order
+#include "templates/wire_struct.hpp"
+
+// Bit-packed records, with compile-time shifts and masks
+#include "templates/bit_fields.hpp"
+
+// Unrolled varint (LEB128) and zigzag encoding, with batch decoding
+#include "templates/varint.hpp"
+
+#endif
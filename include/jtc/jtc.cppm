@@ -0,0 +1,28 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// jtc.cppm - C++20 module interface: all templates in the collection, as the named module 'jtc'
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// An alternative to including jtc.hpp in every translation unit: the headers are parsed once, when the
+// module is built, and importers only load the compiled interface. The module build also runs the tests.
+//
+// JTC has no Standard Library dependencies, so the whole collection is exported from the module
+//   purview, and there's no global module fragment. Its declarations are attached to the module:
+//   a program can't both import it and include the headers.
+// Macros are not exported: configuration macros, such as JTC_TRACE, apply when building the module,
+//   and JTC_TRACE_SCOPE is unavailable to importers.
+//
+// Building with GCC 11 or newer, from the repository root:
+//     g++ -std=c++20 -fmodules-ts -x c++ -c include/jtc/jtc.cppm -o jtc.o
+//     g++ -std=c++20 -fmodules-ts -c main.cpp   // import jtc;
+//     g++ main.o jtc.o
+
+export module jtc;
+
+#define JTC_TESTS
+
+export {
+#include "jtc.hpp"
+}
@@ -17,4 +17,13 @@
 // Utilities for template programming/metaprogramming
 #include "utility.hpp"
 
+// Numerical algorithms and compile-time tables
+#include "numeric.hpp"
+
+// Object lifetime, views and containers
+#include "memory.hpp"
+
+// Byte order and binary encodings
+#include "binary.hpp"
+
 #endif
\ No newline at end of file
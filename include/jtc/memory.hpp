@@ -0,0 +1,44 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// memory.hpp: Object lifetime, views, containers and allocation
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_MEMORY_HPP
+#define JTC_MEMORY_HPP
+
+//-------------------------------------------------------------------------------------------------
+// Object lifetime and views
+//-------------------------------------------------------------------------------------------------
+
+// Emulates construct_at and destroy_at, with a placement new that doesn't require <new>
+#include "templates/construct.hpp"
+
+// Emulates C++20's span, with dynamic extent
+#include "templates/span.hpp"
+
+//-------------------------------------------------------------------------------------------------
+// Containers
+//-------------------------------------------------------------------------------------------------
+
+// Structure-of-arrays containers: soa_array (fixed size) and soa_vector (growable)
+#include "templates/soa.hpp"
+
+// One value per key type, with compile-time lookup and optional lazy construction
+#include "templates/typed_storage.hpp"
+
+// Type-erased values in an inline buffer, with static vtables and RTTI-free any_cast
+#include "templates/inplace_any.hpp"
+
+//-------------------------------------------------------------------------------------------------
+// Allocation
+//-------------------------------------------------------------------------------------------------
+
+// Fixed-capacity pools of one type (object_pool) or of a list of types (multi_pool)
+#include "templates/object_pool.hpp"
+
+// Monotonic arenas, on inline or caller-provided buffers, with destruction on reset
+#include "templates/arena.hpp"
+
+#endif
@@ -0,0 +1,65 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// numeric.hpp: Numerical algorithms and compile-time generated tables
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_NUMERIC_HPP
+#define JTC_NUMERIC_HPP
+
+//-------------------------------------------------------------------------------------------------
+// Integer types and arithmetic
+//-------------------------------------------------------------------------------------------------
+
+// Integer selection by bit width (int_least_t, uint_least_t) and widening (make_wider)
+#include "templates/integer_width.hpp"
+
+// Overflow-checked and saturating integer arithmetic
+#include "templates/saturating.hpp"
+
+// Fixed-point numbers with rounding and overflow policies
+#include "templates/fixed_point.hpp"
+
+//-------------------------------------------------------------------------------------------------
+// Units
+//-------------------------------------------------------------------------------------------------
+
+// Emulates std::ratio, compile-time rational numbers, and the SI prefixes
+#include "templates/ratio.hpp"
+
+// Quantities with units checked at compile time, and unit conversions folded into one constant
+#include "templates/quantity.hpp"
+
+//-------------------------------------------------------------------------------------------------
+// Data-parallel computation
+//-------------------------------------------------------------------------------------------------
+
+// Portable fixed-size SIMD vectors (simd<T, N>) and comparison masks
+#include "templates/simd.hpp"
+
+// Small fixed-size vectors (vec<T, N>), with expression templates that evaluate whole expressions in one pass
+#include "templates/vec.hpp"
+
+//-------------------------------------------------------------------------------------------------
+// Sorting
+//-------------------------------------------------------------------------------------------------
+
+// Branchless sorting networks for small fixed-size arrays, generated at compile time
+#include "templates/sort_network.hpp"
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time tables
+//-------------------------------------------------------------------------------------------------
+
+// Constant lookup tables, generated at compile time from constexpr functions
+#include "templates/lookup_table.hpp"
+
+//-------------------------------------------------------------------------------------------------
+// Checksums
+//-------------------------------------------------------------------------------------------------
+
+// Table-driven and slice-by-N CRC-8/16/32/64 kernels
+#include "templates/crc.hpp"
+
+#endif
\ No newline at end of file
@@ -28,7 +28,7 @@ inline constexpr bool are_same_v() { return are_same<Ts...>::value; }
 // Compile-time Tests
 //-------------------------------------------------------------------------------------------------
 
-#ifndef JTC_NO_TESTS
+#ifdef JTC_TESTS
 
 namespace jtc {
 namespace tests {
@@ -51,6 +51,6 @@ struct are_same_tests {
 }  // namespace tests
 }  // namespace jtc
 
-#endif  // JTC_NO_TESTS
+#endif  // JTC_TESTS
 
 #endif
\ No newline at end of file
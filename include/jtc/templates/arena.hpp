@@ -0,0 +1,171 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// arena.hpp: Monotonic arena allocators, on inline or caller-provided buffers
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_ARENA_HPP
+#define JTC_TEMPLATES_ARENA_HPP
+
+#include "construct.hpp"
+#include "integral_constant.hpp"
+#include "move_forward.hpp"
+#include "std_def.hpp"
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// arena definition
+//
+// A monotonic allocator: each allocation bumps a pointer into a fixed buffer, and memory is only
+//   released all at once, by reset(). Allocations fail by returning nullptr; nothing falls back to the heap.
+//
+// arena<Bytes> owns an inline buffer of Bytes bytes, e.g. as a static or stack object.
+// arena<> works on a caller-provided buffer.
+//
+// make<T>(args...) constructs a T, forwarding args to its constructor. The alignment of T is a
+//   compile-time constant, so the bump is a single add-and-mask.
+// Objects of trivially destructible types are simply forgotten on reset(). For other types, make<T>
+//   also allocates a small node in the arena, which reset() uses to call the destructors, in the
+//   reverse order of construction. The arena's destructor calls reset().
+//
+// Usage:
+//     arena<4096> frame;
+//     request* r = frame.make<request>(id);        // Destroyed on reset
+//     float* samples = frame.make_array<float>(256);  // Uninitialized
+//     ...
+//     frame.reset();
+//-------------------------------------------------------------------------------------------------
+
+template <size_t Bytes = 0>
+class arena;
+
+/// Arena on a caller-provided buffer
+template <>
+class arena<0> {
+ public:
+  /// Arena using the size bytes at buffer
+  arena(void* buffer, size_t size)
+      : begin_(static_cast<unsigned char*>(buffer)), current_(begin_), end_(begin_ + size), destructors_(nullptr) {}
+
+  arena(const arena&) = delete;
+  arena& operator=(const arena&) = delete;
+
+  ~arena() { reset(); }
+
+  /// Total size of the buffer, in bytes
+  size_t capacity() const { return static_cast<size_t>(end_ - begin_); }
+
+  /// Bytes in use, including alignment padding and destructor nodes
+  size_t used() const { return static_cast<size_t>(current_ - begin_); }
+
+  /// Bytes left at the end of the buffer
+  size_t remaining() const { return static_cast<size_t>(end_ - current_); }
+
+  /// size bytes aligned to Align, or nullptr if they don't fit
+  template <size_t Align>
+  void* allocate(size_t size) {
+    static_assert(Align != 0 && (Align & (Align - 1)) == 0, "Alignment must be a power of 2.");
+    const size_t padding = (0 - reinterpret_cast<size_t>(current_)) & (Align - 1);
+    // Not padding + size > remaining(), which wraps around for sizes near SIZE_MAX
+    if (padding > remaining() || size > remaining() - padding) return nullptr;
+    unsigned char* p = current_ + padding;
+    current_ = p + size;
+    return p;
+  }
+
+  /// Constructs a T from args, or returns nullptr if it doesn't fit
+  template <typename T, typename... Args>
+  T* make(Args&&... args) {
+    return make_impl<T>(bool_constant<is_trivially_destructible_v<T>()>{}, jtc::forward<Args>(args)...);
+  }
+
+  /// Uninitialized storage for count objects of type T, or nullptr if they don't fit.
+  /// The objects are never destroyed: T must be trivially destructible.
+  template <typename T>
+  T* make_array(size_t count) {
+    static_assert(is_trivially_destructible_v<T>(), "make_array requires a trivially destructible type.");
+    if (count > remaining() / sizeof(T)) return nullptr;
+    return static_cast<T*>(allocate<alignof(T)>(count * sizeof(T)));
+  }
+
+  /// Destroys the objects with non-trivial destructors, and releases all memory
+  void reset() {
+    for (destructor_node* node = destructors_; node != nullptr; node = node->next) node->destroy(node->object);
+    destructors_ = nullptr;
+    current_ = begin_;
+  }
+
+ private:
+  /// Entry of the list of objects to destroy on reset, newest first
+  struct destructor_node {
+    void (*destroy)(void*);
+    void* object;
+    destructor_node* next;
+  };
+
+  template <typename T>
+  static void destroy(void* object) { jtc::destroy_at(static_cast<T*>(object)); }
+
+  template <typename T, typename... Args>
+  T* make_impl(true_type, Args&&... args) {
+    void* p = allocate<alignof(T)>(sizeof(T));
+    return p == nullptr ? nullptr : jtc::construct_at(static_cast<T*>(p), jtc::forward<Args>(args)...);
+  }
+
+  template <typename T, typename... Args>
+  T* make_impl(false_type, Args&&... args) {
+    unsigned char* const rollback = current_;
+    void* node = allocate<alignof(destructor_node)>(sizeof(destructor_node));
+    void* p = node == nullptr ? nullptr : allocate<alignof(T)>(sizeof(T));
+    if (p == nullptr) {
+      current_ = rollback;
+      return nullptr;
+    }
+    T* object = jtc::construct_at(static_cast<T*>(p), jtc::forward<Args>(args)...);
+    destructors_ = jtc::construct_at(static_cast<destructor_node*>(node), destructor_node{&destroy<T>, object, destructors_});
+    return object;
+  }
+
+  unsigned char* begin_;
+  unsigned char* current_;
+  unsigned char* end_;
+  destructor_node* destructors_;
+};
+
+/// Arena on an inline buffer of Bytes bytes
+template <size_t Bytes>
+class arena : public arena<0> {
+ public:
+  arena() : arena<0>(buffer_, Bytes) {}
+
+  /// Destroys the objects while the buffer is still alive
+  ~arena() { reset(); }
+
+ private:
+  alignas(alignof(long double) > alignof(void*) ? alignof(long double) : alignof(void*)) unsigned char buffer_[Bytes];
+};
+
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+struct arena_tests {
+  static_assert(sizeof(jtc::arena<>) == 4 * sizeof(void*), "JTC test failed!");
+  static_assert(sizeof(jtc::arena<256>) >= 256 + sizeof(jtc::arena<>), "JTC test failed!");
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
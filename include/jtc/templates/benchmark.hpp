@@ -0,0 +1,268 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// benchmark.hpp: Microbenchmark harness, with warmup, sampling statistics and JSON output
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_BENCHMARK_HPP
+#define JTC_TEMPLATES_BENCHMARK_HPP
+
+// Unlike the rest of the collection, the harness is meant for hosted environments: it reads CLOCK_MONOTONIC
+//   and prints through stdio. So it's not part of any of the aggregate headers, and must be included directly.
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "std_def.hpp"
+#include "std_int.hpp"
+#include "trace.hpp"
+
+// JTC_BENCH_MAX_RESULTS is the number of benchmarks a runner keeps. JTC_BENCH_MAX_SAMPLES bounds options::samples.
+#ifndef JTC_BENCH_MAX_RESULTS
+#define JTC_BENCH_MAX_RESULTS 64
+#endif
+
+#ifndef JTC_BENCH_MAX_SAMPLES
+#define JTC_BENCH_MAX_SAMPLES 64
+#endif
+
+namespace jtc {
+namespace bench {
+
+//-------------------------------------------------------------------------------------------------
+// Optimization barriers
+//
+// do_not_optimize(value) makes the compiler assume value is read, and possibly written, by unknown code:
+//   the computation of value can't be removed, and a value used as input can't be constant-folded.
+// clobber_memory() makes it assume all memory is read and written, so pending stores must happen.
+// Both emit no instructions.
+//-------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void do_not_optimize(const T& value) {
+  __asm__ __volatile__("" : : "r,m"(value) : "memory");
+}
+
+template <typename T>
+inline void do_not_optimize(T& value) {
+  __asm__ __volatile__("" : "+r,m"(value) : : "memory");
+}
+
+inline void clobber_memory() { __asm__ __volatile__("" : : : "memory"); }
+
+//-------------------------------------------------------------------------------------------------
+// Clocks
+//
+// Time is measured with CLOCK_MONOTONIC, in nanoseconds, and with the trace counter, in cycles:
+//   reference cycles of the time-stamp counter on x86, or ticks of the virtual counter on ARMv8.
+//   Where there's no counter, cycles are nanoseconds.
+//-------------------------------------------------------------------------------------------------
+
+inline uint64_t nanoseconds() {
+  timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return static_cast<uint64_t>(time.tv_sec) * 1000000000u + static_cast<uint64_t>(time.tv_nsec);
+}
+
+inline uint64_t cycles() {
+#ifdef JTC_TRACE_COUNTER
+  return trace::now();
+#else
+  return nanoseconds();
+#endif
+}
+
+/// Name of the cycle counter, as reported in the output
+inline const char* cycle_source() {
+#ifdef JTC_TRACE_COUNTER
+  return trace::source() == trace::clock_source::cycles            ? "cycles"
+         : trace::source() == trace::clock_source::virtual_counter ? "virtual_counter"
+                                                                   : "nanoseconds";
+#else
+  return "nanoseconds";
+#endif
+}
+
+//-------------------------------------------------------------------------------------------------
+// Results
+//-------------------------------------------------------------------------------------------------
+
+/// Summary of the per-operation cost over all samples
+struct summary {
+  double min;
+  double median;
+  double mean;
+  double stddev;
+  double max;
+};
+
+struct result {
+  const char* name;
+  uint64_t iterations;  ///< Operations per sample
+  size_t samples;
+  summary ns;      ///< Nanoseconds per operation
+  summary cycles;  ///< Cycles per operation
+};
+
+struct options {
+  uint64_t warmup_ns = 50000000;  ///< Time spent running, and calibrating the batch size, before sampling
+  uint64_t sample_ns = 5000000;   ///< Target duration of each sample
+  size_t samples = 25;            ///< Number of samples, at most JTC_BENCH_MAX_SAMPLES
+};
+
+namespace detail {
+
+/// Sorts values, then computes their statistics
+inline summary summarize(double* values, size_t count) {
+  for (size_t i = 1; i < count; i++) {
+    const double value = values[i];
+    size_t j = i;
+    for (; j > 0 && values[j - 1] > value; j--) values[j] = values[j - 1];
+    values[j] = value;
+  }
+
+  double total = 0;
+  for (size_t i = 0; i < count; i++) total += values[i];
+  const double mean = total / count;
+
+  double squares = 0;
+  for (size_t i = 0; i < count; i++) squares += (values[i] - mean) * (values[i] - mean);
+
+  summary s;
+  s.min = values[0];
+  s.median = count % 2 == 1 ? values[count / 2] : (values[count / 2 - 1] + values[count / 2]) / 2;
+  s.mean = mean;
+  s.stddev = count > 1 ? sqrt(squares / (count - 1)) : 0;
+  s.max = values[count - 1];
+  return s;
+}
+
+inline bool name_contains(const char* text, const char* pattern) {
+  for (; *text != '\0'; text++) {
+    size_t i = 0;
+    while (pattern[i] != '\0' && text[i] == pattern[i]) i++;
+    if (pattern[i] == '\0') return true;
+  }
+  return *pattern == '\0';
+}
+
+inline void print_summary(FILE* out, const char* name, const summary& s) {
+  fprintf(out, "\"%s\": {\"min\": %.3f, \"median\": %.3f, \"mean\": %.3f, \"stddev\": %.3f, \"max\": %.3f}", name, s.min,
+          s.median, s.mean, s.stddev, s.max);
+}
+
+}  // namespace detail
+
+//-------------------------------------------------------------------------------------------------
+// runner
+//
+// run(name, f) measures the cost of calling f(), which performs one operation.
+//   f is called in batches. During warmup, the batch size doubles until a batch takes options::sample_ns.
+//   Then each sample times one batch, and the cost per operation is the batch time over its size.
+//   The loop around f() costs about one cycle per operation, so f should do more than that.
+// Results are kept in order, and printed as a table or as JSON.
+//
+// Usage:
+//     jtc::bench::runner r;
+//     r.run("crc32/4096", [&] { jtc::bench::do_not_optimize(jtc::crc<jtc::crc32_model>::compute(data, 4096)); });
+//     r.print_table(stdout);
+//-------------------------------------------------------------------------------------------------
+
+class runner {
+ public:
+  explicit runner(options opts = options()) : options_(opts), filter_(""), size_(0) {
+    if (options_.samples == 0) options_.samples = 1;
+    if (options_.samples > JTC_BENCH_MAX_SAMPLES) options_.samples = JTC_BENCH_MAX_SAMPLES;
+  }
+
+  /// Only benchmarks whose name contains pattern are run. The pattern must outlive the runner.
+  void filter(const char* pattern) { filter_ = pattern; }
+
+  /// Runs a benchmark. Returns its result, or nullptr if it was filtered out or there's no room for it.
+  template <typename F>
+  const result* run(const char* name, F&& f) {
+    if (!detail::name_contains(name, filter_) || size_ == JTC_BENCH_MAX_RESULTS) return nullptr;
+
+    uint64_t batch = 1;
+    const uint64_t warmup_end = nanoseconds() + options_.warmup_ns;
+    for (;;) {
+      const uint64_t start = nanoseconds();
+      run_batch(f, batch);
+      const uint64_t end = nanoseconds();
+      if (end >= warmup_end && end - start >= options_.sample_ns) break;
+      if (end - start < options_.sample_ns) batch *= 2;
+    }
+
+    double ns[JTC_BENCH_MAX_SAMPLES];
+    double cycles[JTC_BENCH_MAX_SAMPLES];
+    for (size_t i = 0; i < options_.samples; i++) {
+      const uint64_t start_ns = nanoseconds();
+      const uint64_t start_cycles = bench::cycles();
+      run_batch(f, batch);
+      const uint64_t end_cycles = bench::cycles();
+      const uint64_t end_ns = nanoseconds();
+      ns[i] = static_cast<double>(end_ns - start_ns) / batch;
+      cycles[i] = static_cast<double>(end_cycles - start_cycles) / batch;
+    }
+
+    result& r = results_[size_++];
+    r.name = name;
+    r.iterations = batch;
+    r.samples = options_.samples;
+    r.ns = detail::summarize(ns, options_.samples);
+    r.cycles = detail::summarize(cycles, options_.samples);
+    return &r;
+  }
+
+  size_t size() const { return size_; }
+  const result& operator[](size_t i) const { return results_[i]; }
+
+  /// One line per benchmark, with the median and deviation of each measure
+  void print_table(FILE* out) const {
+    fprintf(out, "%-40s %12s %10s %12s %10s\n", "benchmark", "ns/op", "stddev", cycle_source(), "stddev");
+    for (size_t i = 0; i < size_; i++) {
+      const result& r = results_[i];
+      fprintf(out, "%-40s %12.3f %10.3f %12.3f %10.3f\n", r.name, r.ns.median, r.ns.stddev, r.cycles.median,
+              r.cycles.stddev);
+    }
+  }
+
+  /// A context object, with the cycle counter's source and frequency, and an array of results
+  void print_json(FILE* out) const {
+#ifdef JTC_TRACE_COUNTER
+    const uint64_t frequency = trace::frequency();
+#else
+    const uint64_t frequency = 1000000000u;
+#endif
+    fprintf(out, "{\n  \"context\": {\"cycle_source\": \"%s\", \"cycle_frequency\": %llu},\n  \"benchmarks\": [",
+            cycle_source(), static_cast<unsigned long long>(frequency));
+    for (size_t i = 0; i < size_; i++) {
+      const result& r = results_[i];
+      fprintf(out, "%s\n    {\"name\": \"%s\", \"iterations\": %llu, \"samples\": %llu,\n     ", i == 0 ? "" : ",",
+              r.name, static_cast<unsigned long long>(r.iterations), static_cast<unsigned long long>(r.samples));
+      detail::print_summary(out, "ns_per_op", r.ns);
+      fprintf(out, ",\n     ");
+      detail::print_summary(out, "cycles_per_op", r.cycles);
+      fprintf(out, "}");
+    }
+    fprintf(out, "\n  ]\n}\n");
+  }
+
+ private:
+  template <typename F>
+  static void run_batch(F& f, uint64_t batch) {
+    for (uint64_t i = 0; i < batch; i++) f();
+    clobber_memory();
+  }
+
+  options options_;
+  const char* filter_;
+  result results_[JTC_BENCH_MAX_RESULTS];
+  size_t size_;
+};
+
+}  // namespace bench
+}  // namespace jtc
+
+#endif
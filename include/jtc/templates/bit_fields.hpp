@@ -0,0 +1,250 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// bit_fields.hpp: Portable bit-packed records, with the layout computed at compile time
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_BIT_FIELDS_HPP
+#define JTC_TEMPLATES_BIT_FIELDS_HPP
+
+#include "integer_width.hpp"
+#include "integral_constant.hpp"
+#include "std_def.hpp"
+#include "std_int.hpp"
+#include "type_list.hpp"
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// bit_fields definition
+//
+// bit_fields<bit_field<Tag, Bits>...> packs unsigned fields of 1 to 64 bits, identified by tag types.
+// Unlike C bit-fields, the layout is specified: fields are stored in declaration order, from the
+//   least significant bit of the first word. A field never straddles two words: if it doesn't fit
+//   in the rest of a word, it starts the next one.
+// The word type is the smallest fixed-width type holding all fields, or uint64_t when they need
+//   more than 64 bits.
+//
+// Shifts and masks are compile-time constants: get<Tag>() is a shift and a mask, and set<Tag>(v)
+//   is a single read-modify-write of one word. update<Tags...>(values...) writes several fields
+//   with one read-modify-write per word.
+//
+// Usage:
+//     struct mode {}; struct speed {}; struct enable {};
+//     using control = bit_fields<bit_field<mode, 3>, bit_field<speed, 12>, bit_field<enable, 1>>;
+//     static_assert(sizeof(control) == 2, "Should fit in an uint16_t");
+//
+//     control reg(read_register());
+//     reg.update<mode, enable>(5, 1);
+//     uint16_t s = reg.get<speed>();
+//     write_register(reg.word(0));
+//-------------------------------------------------------------------------------------------------
+
+/// A field of Bits bits, identified by Tag
+template <typename Tag, size_t Bits>
+struct bit_field {
+  static_assert(Bits > 0 && Bits <= 64, "A bit_field must have 1 to 64 bits.");
+  using tag = Tag;
+  constexpr static size_t bits = Bits;
+};
+
+// Forward declaration of the implementation
+namespace detail {
+template <typename Fields, size_t WordBits, size_t I> struct bit_field_position;
+template <typename Word> constexpr Word bit_fields_or();
+template <typename Word, typename... Words> constexpr Word bit_fields_or(Word word, Words... words);
+constexpr size_t bit_fields_total() { return 0; }
+template <typename... Sizes>
+constexpr size_t bit_fields_total(size_t bits, Sizes... sizes) { return bits + bit_fields_total(sizes...); }
+constexpr size_t bit_fields_word_bits(size_t total) { return total <= 8 ? 8 : total <= 16 ? 16 : total <= 32 ? 32 : 64; }
+}  // namespace detail
+
+template <typename... Fields>
+class bit_fields {
+  static_assert(sizeof...(Fields) > 0, "bit_fields requires at least one field.");
+  static_assert(list_unique_t<type_list<typename Fields::tag...>>::size == sizeof...(Fields),
+                "Duplicate bit_field tag.");
+
+  using fields = type_list<Fields...>;
+  using tags = type_list<typename Fields::tag...>;
+
+  /// Index of the field Tag
+  template <typename Tag>
+  struct field_index : integral_constant<size_t, list_index_of_v<tags, Tag>()> {
+    static_assert(list_has_type<tags, Tag>(), "Unknown bit_field tag.");
+  };
+
+ public:
+  /// Storage word
+  using word_type = uint_least_t<detail::bit_fields_word_bits(detail::bit_fields_total(Fields::bits...))>;
+
+ private:
+  template <typename Tag>
+  using position = detail::bit_field_position<fields, sizeof(word_type) * 8, field_index<Tag>::value>;
+
+ public:
+  /// Number of storage words
+  constexpr static size_t word_count() {
+    return detail::bit_field_position<fields, sizeof(word_type) * 8, sizeof...(Fields) - 1>::word + 1;
+  }
+
+  /// Whether Tag identifies a field
+  template <typename Tag>
+  constexpr static bool has_field() { return list_has_type<tags, Tag>(); }
+
+  /// Value type of the field Tag: the smallest unsigned type with enough bits
+  template <typename Tag>
+  using value_t = uint_least_t<list_get_t<fields, field_index<Tag>::value>::bits>;
+
+  /// Width of the field Tag
+  template <typename Tag>
+  constexpr static size_t bits() { return list_get_t<fields, field_index<Tag>::value>::bits; }
+
+  /// Index of the word storing the field Tag
+  template <typename Tag>
+  constexpr static size_t word_index() { return position<Tag>::word; }
+
+  /// Position of the least significant bit of the field Tag, in its word
+  template <typename Tag>
+  constexpr static size_t shift() { return position<Tag>::shift; }
+
+  /// Mask of the field Tag, in its word
+  template <typename Tag>
+  constexpr static word_type mask() {
+    return static_cast<word_type>((bits<Tag>() == 64 ? ~uint64_t(0) : (uint64_t(1) << bits<Tag>()) - 1) << shift<Tag>());
+  }
+
+  /// All fields zero
+  constexpr bit_fields() : words_{} {}
+
+  /// Fields stored in a single word, e.g. a register value
+  constexpr explicit bit_fields(word_type word) : words_{word} {
+    static_assert(word_count() == 1, "Construction from a word requires single-word bit_fields.");
+  }
+
+  /// Reads the field Tag
+  template <typename Tag>
+  constexpr value_t<Tag> get() const {
+    return static_cast<value_t<Tag>>((words_[word_index<Tag>()] & mask<Tag>()) >> shift<Tag>());
+  }
+
+  /// Writes the field Tag. Bits of value beyond the field's width are discarded.
+  template <typename Tag>
+  void set(value_t<Tag> value) {
+    word_type& word = words_[word_index<Tag>()];
+    word = static_cast<word_type>((word & ~mask<Tag>()) | placed<Tag>(value));
+  }
+
+  /// Writes the fields Tags, with one read-modify-write per word. Each field may appear only once.
+  template <typename... Tags>
+  void update(value_t<Tags>... values) {
+    static_assert(list_unique_t<type_list<Tags...>>::size == sizeof...(Tags), "Duplicate bit_field tag in update.");
+    for (size_t i = 0; i < word_count(); i++) {
+      const word_type clear =
+          detail::bit_fields_or<word_type>((word_index<Tags>() == i ? mask<Tags>() : word_type(0))...);
+      if (clear == 0) continue;
+      const word_type bits =
+          detail::bit_fields_or<word_type>((word_index<Tags>() == i ? placed<Tags>(values) : word_type(0))...);
+      words_[i] = static_cast<word_type>((words_[i] & ~clear) | bits);
+    }
+  }
+
+  /// Raw storage word i
+  constexpr word_type word(size_t i) const { return words_[i]; }
+
+  /// Replaces the raw storage word i
+  void set_word(size_t i, word_type value) { words_[i] = value; }
+
+  /// Raw storage
+  const word_type* data() const { return words_; }
+  word_type* data() { return words_; }
+
+ private:
+  /// value, moved to the position of the field Tag
+  template <typename Tag>
+  constexpr static word_type placed(value_t<Tag> value) {
+    return static_cast<word_type>((static_cast<word_type>(value) << shift<Tag>()) & mask<Tag>());
+  }
+
+  word_type words_[word_count()];
+};
+
+//-------------------------------------------------------------------------------------------------
+// Layout implementation
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+/// Position of the field I: right after the field I - 1, or at the start of the next word
+template <typename Fields, size_t WordBits, size_t I>
+struct bit_field_position {
+  using previous = bit_field_position<Fields, WordBits, I - 1>;
+  constexpr static size_t previous_end = previous::shift + list_get_t<Fields, I - 1>::bits;
+  constexpr static bool fits = previous_end + list_get_t<Fields, I>::bits <= WordBits;
+
+  constexpr static size_t word = fits ? previous::word : previous::word + 1;
+  constexpr static size_t shift = fits ? previous_end : 0;
+};
+
+template <typename Fields, size_t WordBits>
+struct bit_field_position<Fields, WordBits, 0> {
+  constexpr static size_t word = 0;
+  constexpr static size_t shift = 0;
+};
+
+template <typename Word>
+constexpr Word bit_fields_or() { return 0; }
+
+template <typename Word, typename... Words>
+constexpr Word bit_fields_or(Word word, Words... words) {
+  return static_cast<Word>(word | bit_fields_or<Word>(words...));
+}
+
+}  // namespace detail
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+namespace bit_fields_helpers {
+struct a {}; struct b {}; struct c {}; struct d {};
+using small = jtc::bit_fields<jtc::bit_field<a, 3>, jtc::bit_field<b, 12>, jtc::bit_field<c, 1>>;
+using wide = jtc::bit_fields<jtc::bit_field<a, 40>, jtc::bit_field<b, 13>, jtc::bit_field<c, 20>, jtc::bit_field<d, 64>>;
+}  // namespace bit_fields_helpers
+
+struct bit_fields_tests {
+  using small = bit_fields_helpers::small;
+  using wide = bit_fields_helpers::wide;
+  using a = bit_fields_helpers::a;
+  using b = bit_fields_helpers::b;
+  using c = bit_fields_helpers::c;
+  using d = bit_fields_helpers::d;
+
+  // Single word
+  static_assert(jtc::is_same_v<small::word_type, jtc::uint16_t>() && sizeof(small) == 2, "JTC test failed!");
+  static_assert(small::word_count() == 1, "JTC test failed!");
+  static_assert(small::shift<b>() == 3 && small::mask<b>() == 0x7FF8, "JTC test failed!");
+  static_assert(jtc::is_same_v<small::value_t<b>, jtc::uint16_t>(), "JTC test failed!");
+  static_assert(small(0x8005).get<a>() == 5 && small(0x8005).get<c>() == 1, "JTC test failed!");
+  static_assert(small(0xFFFF).get<b>() == 0xFFF, "JTC test failed!");
+
+  // Many words: fields don't straddle words
+  static_assert(jtc::is_same_v<wide::word_type, jtc::uint64_t>() && wide::word_count() == 3, "JTC test failed!");
+  static_assert(wide::word_index<b>() == 0 && wide::shift<b>() == 40, "JTC test failed!");
+  static_assert(wide::word_index<c>() == 1 && wide::shift<c>() == 0, "JTC test failed!");
+  static_assert(wide::word_index<d>() == 2 && wide::mask<d>() == ~jtc::uint64_t(0), "JTC test failed!");
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
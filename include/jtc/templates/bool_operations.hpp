@@ -84,7 +84,7 @@ inline constexpr bool bool_xor_v() { return bool_xor<BoolTypes...>::value; }
 // Compile-time Tests
 //-------------------------------------------------------------------------------------------------
 
-#ifndef JTC_NO_TESTS
+#ifdef JTC_TESTS
 
 namespace jtc {
 namespace tests {
@@ -143,6 +143,6 @@ struct bool_operators_pack_test {
 }  // namespace tests
 }  // namespace jtc
 
-#endif  // JTC_NO_TESTS
+#endif  // JTC_TESTS
 
 #endif
\ No newline at end of file
@@ -0,0 +1,97 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// construct.hpp: Emulates C++20's std::construct_at and C++17's std::destroy_at, without <new>
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_CONSTRUCT_HPP
+#define JTC_TEMPLATES_CONSTRUCT_HPP
+
+#include "integral_constant.hpp"
+#include "move_forward.hpp"
+#include "std_def.hpp"
+
+//-------------------------------------------------------------------------------------------------
+// Placement new
+//
+// The standard placement new is declared in <new>. JTC declares its own placement form instead,
+//   distinguished by a tag parameter, so it never conflicts with the standard one.
+//-------------------------------------------------------------------------------------------------
+
+namespace jtc {
+namespace detail { struct construct_tag {}; }
+}  // namespace jtc
+
+inline void* operator new(jtc::size_t, void* where, jtc::detail::construct_tag) { return where; }
+
+// Matching deallocation function, called if the constructor throws
+inline void operator delete(void*, void*, jtc::detail::construct_tag) {}
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// Object lifetime
+//
+// Usage:
+//     alignas(T) unsigned char buffer[sizeof(T)];
+//     T* object = construct_at(reinterpret_cast<T*>(buffer), arg1, arg2);
+//     destroy_at(object);
+//-------------------------------------------------------------------------------------------------
+
+/// Constructs a T at the address where, forwarding args to its constructor
+template <typename T, typename... Args>
+inline T* construct_at(T* where, Args&&... args) {
+  return ::new (static_cast<void*>(where), detail::construct_tag{}) T(jtc::forward<Args>(args)...);
+}
+
+/// Calls the destructor of the object at the address p
+template <typename T>
+inline void destroy_at(T* p) {
+  p->~T();
+}
+
+//-------------------------------------------------------------------------------------------------
+// Destruction traits
+//
+// Emulates std::is_trivially_destructible, through compiler intrinsics.
+// Containers use it to skip destruction loops for types such as integers and POD structs.
+//-------------------------------------------------------------------------------------------------
+
+#if defined(__clang__)
+template <typename T> struct is_trivially_destructible : bool_constant<__is_trivially_destructible(T)> {};
+#else
+template <typename T> struct is_trivially_destructible : bool_constant<__has_trivial_destructor(T)> {};
+#endif
+
+template <typename T>
+inline constexpr bool is_trivially_destructible_v() { return is_trivially_destructible<T>::value; }
+
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+namespace construct_helpers {
+struct trivial { int x; };
+struct non_trivial { ~non_trivial() {} };
+}  // namespace construct_helpers
+
+struct construct_tests {
+  static_assert(jtc::is_trivially_destructible_v<int>(), "JTC test failed!");
+  static_assert(jtc::is_trivially_destructible_v<construct_helpers::trivial>(), "JTC test failed!");
+  static_assert(!jtc::is_trivially_destructible_v<construct_helpers::non_trivial>(), "JTC test failed!");
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
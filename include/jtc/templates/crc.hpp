@@ -0,0 +1,302 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// crc.hpp: Table-driven and slice-by-N CRC kernels, with tables generated at compile time
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_CRC_HPP
+#define JTC_TEMPLATES_CRC_HPP
+
+#include "lookup_table.hpp"
+#include "number_traits.hpp"
+#include "std_def.hpp"
+#include "std_int.hpp"
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// CRC Models
+//
+// Describes a CRC algorithm, in the usual "Rocksoft" parametrization:
+//   T: Unsigned integer type of the CRC. The CRC width is the width of T (8, 16, 32 or 64 bits).
+//   Polynomial: Generator polynomial, in normal (MSB-first) notation, without the leading term.
+//   Initial: Initial value of the CRC register.
+//   FinalXor: Value XOR'ed into the register to produce the final CRC.
+//   Reflected: Whether input bytes and the output are bit-reflected (RefIn == RefOut).
+//
+// Usage:
+//     using my_crc = crc_model<uint16_t, 0x1021, 0x0000, 0x0000, false>;  // CRC-16/XMODEM
+//-------------------------------------------------------------------------------------------------
+
+template <typename T, T Polynomial, T Initial, T FinalXor, bool Reflected>
+struct crc_model {
+  static_assert(is_unsigned_v<T>(), "The CRC type must be an unsigned integer.");
+
+  /// Type of the CRC register
+  using value_type = T;
+  /// CRC width, in bits
+  constexpr static size_t width = sizeof(T) * 8;
+  /// Model parameters
+  constexpr static T polynomial = Polynomial;
+  constexpr static T initial = Initial;
+  constexpr static T final_xor = FinalXor;
+  constexpr static bool reflected = Reflected;
+};
+
+/// CRC-8/SMBUS
+using crc8_model = crc_model<uint8_t, 0x07, 0x00, 0x00, false>;
+
+/// CRC-16/CCITT-FALSE
+using crc16_ccitt_model = crc_model<uint16_t, 0x1021, 0xFFFF, 0x0000, false>;
+
+/// CRC-16/ARC
+using crc16_arc_model = crc_model<uint16_t, 0x8005, 0x0000, 0x0000, true>;
+
+/// CRC-32, as used by zlib, Ethernet and PNG
+using crc32_model = crc_model<uint32_t, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, true>;
+
+/// CRC-32C (Castagnoli), as used by iSCSI and SSE4.2
+using crc32c_model = crc_model<uint32_t, 0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF, true>;
+
+/// CRC-64/XZ
+using crc64_model = crc_model<uint64_t, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, true>;
+
+//-------------------------------------------------------------------------------------------------
+// CRC Tables
+//
+// crc_table<Model>: the 256-entry table for byte-wise processing.
+// crc_slice_tables<Model, Slices>: Slices tables, where table k holds the CRC of a byte followed by k zero bytes.
+//
+// Both are static_table's, i.e. computed at compile time and stored once, in read-only memory.
+//-------------------------------------------------------------------------------------------------
+
+// Forward declaration of the register operations and table generators
+namespace detail {
+template <typename Model> struct crc_register;
+template <typename Model> struct crc_byte_generator;
+template <typename Model> struct crc_slice_generator;
+}  // namespace detail
+
+template <typename Model>
+using crc_table = static_table<typename Model::value_type, 256, detail::crc_byte_generator<Model>>;
+
+template <typename Model, size_t Slices>
+using crc_slice_tables =
+    static_table<lookup_table<typename Model::value_type, 256>, Slices, detail::crc_slice_generator<Model>>;
+
+//-------------------------------------------------------------------------------------------------
+// CRC Kernels
+//
+// update() processes data one byte at a time, with a single table lookup per byte.
+// update_sliced<N>() processes N bytes per iteration, with N independent lookups (slice-by-N).
+//   N must be at least the CRC size in bytes. Typical choices are 4, 8 and 16.
+// literal() computes the CRC of a string literal at compile time.
+//
+// Usage:
+//     auto crc = jtc::crc<jtc::crc32_model>::compute(buffer, size);
+//     auto fast_crc = jtc::crc<jtc::crc32_model>::compute_sliced<8>(buffer, size);
+//     static_assert(jtc::crc<jtc::crc32_model>::literal("123456789") == 0xCBF43926, "...");
+//
+//     // Incremental computation:
+//     auto state = jtc::crc<jtc::crc32_model>::init();
+//     state = jtc::crc<jtc::crc32_model>::update(state, chunk1, size1);
+//     state = jtc::crc<jtc::crc32_model>::update(state, chunk2, size2);
+//     auto result = jtc::crc<jtc::crc32_model>::finalize(state);
+//-------------------------------------------------------------------------------------------------
+
+template <typename Model>
+struct crc {
+  /// Type of the CRC register
+  using value_type = typename Model::value_type;
+
+  /// Initial register state
+  constexpr static value_type init() { return Model::reflected ? reg::reflect(Model::initial) : Model::initial; }
+
+  /// Processes a single byte
+  constexpr static value_type step(value_type state, unsigned char byte) {
+    return Model::reflected
+               ? static_cast<value_type>(reg::shift_out(state) ^ crc_table<Model>::value[(state ^ byte) & 0xFF])
+               : static_cast<value_type>(reg::shift_out(state) ^ crc_table<Model>::value[(reg::top_byte(state) ^ byte) & 0xFF]);
+  }
+
+  /// Processes size bytes, one at a time
+  static value_type update(value_type state, const void* data, size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++) state = step(state, bytes[i]);
+    return state;
+  }
+
+  /// Processes size bytes, Slices bytes at a time
+  template <size_t Slices>
+  static value_type update_sliced(value_type state, const void* data, size_t size) {
+    static_assert(Slices >= sizeof(value_type), "Slice-by-N requires N to be at least the CRC size in bytes.");
+    const auto& tables = crc_slice_tables<Model, Slices>::value;
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+
+    for (; size >= Slices; size -= Slices, bytes += Slices) {
+      value_type result = 0;
+      // The first bytes are combined with the register contents
+      for (size_t i = 0; i < sizeof(value_type); i++)
+        result ^= tables[Slices - 1 - i][(bytes[i] ^ reg::byte(state, i)) & 0xFF];
+      // The remaining bytes don't overlap with the register
+      for (size_t i = sizeof(value_type); i < Slices; i++) result ^= tables[Slices - 1 - i][bytes[i]];
+      state = result;
+    }
+
+    return update(state, bytes, size);
+  }
+
+  /// Transforms a register state into the CRC value
+  constexpr static value_type finalize(value_type state) {
+    return static_cast<value_type>(state ^ Model::final_xor);
+  }
+
+  /// Computes the CRC of a buffer, one byte at a time
+  static value_type compute(const void* data, size_t size) { return finalize(update(init(), data, size)); }
+
+  /// Computes the CRC of a buffer, Slices bytes at a time
+  template <size_t Slices>
+  static value_type compute_sliced(const void* data, size_t size) {
+    return finalize(update_sliced<Slices>(init(), data, size));
+  }
+
+  /// Computes the CRC of a string literal, excluding its null terminator, at compile time
+  template <size_t N>
+  constexpr static value_type literal(const char (&str)[N]) {
+    return finalize(literal_update(init(), str, N - 1));
+  }
+
+ private:
+  using reg = detail::crc_register<Model>;
+
+  /// Recursive implementation of literal()
+  constexpr static value_type literal_update(value_type state, const char* str, size_t size) {
+    return size == 0 ? state : literal_update(step(state, static_cast<unsigned char>(*str)), str + 1, size - 1);
+  }
+};
+
+//-------------------------------------------------------------------------------------------------
+// CRC table generation, using bit-by-bit CRC computation
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+/// Operations on the CRC register, shared by the kernels and the table generators
+template <typename Model>
+struct crc_register {
+  using value_type = typename Model::value_type;
+  constexpr static size_t width = Model::width;
+
+  /// Bit-reflection of value, which must be initially called with bits == width
+  constexpr static value_type reflect(value_type value, size_t bits = width) {
+    return bits == 0 ? 0
+                     : static_cast<value_type>(static_cast<value_type>((value & 1u) << (bits - 1)) |
+                                               reflect(static_cast<value_type>(value >> 1), bits - 1));
+  }
+
+  /// Removes the byte processed by the next step from the register
+  constexpr static value_type shift_out(value_type state) {
+    return Model::reflected ? static_cast<value_type>(state >> 8) : static_cast<value_type>(state << 8);
+  }
+
+  /// Most significant byte of the register
+  constexpr static value_type top_byte(value_type state) { return static_cast<value_type>(state >> (width - 8)); }
+
+  /// Byte of the register that combines with the i-th input byte of a slice
+  constexpr static value_type byte(value_type state, size_t i) {
+    return Model::reflected ? static_cast<value_type>(state >> (8 * i))
+                            : static_cast<value_type>(state >> (width - 8 * (i + 1)));
+  }
+};
+
+template <typename Model>
+struct crc_byte_generator {
+  using value_type = typename Model::value_type;
+  constexpr static size_t width = Model::width;
+  constexpr static value_type top_bit = static_cast<value_type>(value_type(1) << (width - 1));
+
+  /// One bit of the bit-by-bit CRC algorithm, for reflected and non-reflected models
+  constexpr static value_type shift_bit(value_type reg, value_type polynomial) {
+    return Model::reflected ? static_cast<value_type>((reg & 1u) ? (reg >> 1) ^ polynomial : (reg >> 1))
+                            : static_cast<value_type>((reg & top_bit) ? static_cast<value_type>(reg << 1) ^ polynomial
+                                                                      : static_cast<value_type>(reg << 1));
+  }
+
+  /// Applies shift_bit 'bits' times
+  constexpr static value_type shift_bits(value_type reg, value_type polynomial, size_t bits) {
+    return bits == 0 ? reg : shift_bits(shift_bit(reg, polynomial), polynomial, bits - 1);
+  }
+
+  constexpr value_type operator()(size_t byte) const {
+    return Model::reflected
+               ? shift_bits(static_cast<value_type>(byte), crc_register<Model>::reflect(Model::polynomial), 8)
+               : shift_bits(static_cast<value_type>(static_cast<value_type>(byte) << (width - 8)), Model::polynomial, 8);
+  }
+};
+
+template <typename Model>
+struct crc_slice_entry_generator {
+  using value_type = typename Model::value_type;
+
+  /// Index of the table being generated
+  size_t slice;
+
+  /// Extends the CRC of 'entry' by a zero byte
+  constexpr static value_type extend(value_type entry) {
+    using reg = crc_register<Model>;
+    return static_cast<value_type>(reg::shift_out(entry) ^
+                                   crc_byte_generator<Model>{}((Model::reflected ? entry : reg::top_byte(entry)) & 0xFF));
+  }
+
+  constexpr static value_type entry(size_t k, size_t byte) {
+    return k == 0 ? crc_byte_generator<Model>{}(byte) : extend(entry(k - 1, byte));
+  }
+
+  constexpr value_type operator()(size_t byte) const { return entry(slice, byte); }
+};
+
+template <typename Model>
+struct crc_slice_generator {
+  constexpr lookup_table<typename Model::value_type, 256> operator()(size_t slice) const {
+    return make_lookup_table<typename Model::value_type, 256>(crc_slice_entry_generator<Model>{slice});
+  }
+};
+
+}  // namespace detail
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+struct crc_tests {
+  // Well-known table entries
+  static_assert(jtc::crc_table<jtc::crc32_model>::value[1] == 0x77073096, "JTC test failed!");
+  static_assert(jtc::crc_table<jtc::crc32_model>::value[255] == 0x2D02EF8D, "JTC test failed!");
+  static_assert(jtc::crc_table<jtc::crc16_ccitt_model>::value[1] == 0x1021, "JTC test failed!");
+  static_assert(jtc::crc_table<jtc::crc8_model>::value[1] == 0x07, "JTC test failed!");
+
+  // Check values: CRC of "123456789"
+  static_assert(jtc::crc<jtc::crc8_model>::literal("123456789") == 0xF4, "JTC test failed!");
+  static_assert(jtc::crc<jtc::crc16_ccitt_model>::literal("123456789") == 0x29B1, "JTC test failed!");
+  static_assert(jtc::crc<jtc::crc16_arc_model>::literal("123456789") == 0xBB3D, "JTC test failed!");
+  static_assert(jtc::crc<jtc::crc32_model>::literal("123456789") == 0xCBF43926, "JTC test failed!");
+  static_assert(jtc::crc<jtc::crc32c_model>::literal("123456789") == 0xE3069283, "JTC test failed!");
+  static_assert(jtc::crc<jtc::crc64_model>::literal("123456789") == 0x995DC9BBDF1939FA, "JTC test failed!");
+
+  // Empty input
+  static_assert(jtc::crc<jtc::crc32_model>::literal("") == 0, "JTC test failed!");
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
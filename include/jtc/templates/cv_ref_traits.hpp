@@ -171,7 +171,7 @@ template <typename From, typename To> using  copy_cvref_t = typename copy_cvref<
 // Compile-time Tests
 //-------------------------------------------------------------------------------------------------
 
-#ifndef JTC_NO_TESTS
+#ifdef JTC_TESTS
 
 namespace jtc {
 namespace tests {
@@ -182,6 +182,6 @@ namespace tests {
 } // namespace tests
 } // namespace jtc
 
-#endif // JTC_NO_TESTS
+#endif  // JTC_TESTS
 
 #endif
\ No newline at end of file
@@ -0,0 +1,168 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// endian.hpp: Byte order detection, byte swapping, and unaligned loads/stores in a given byte order
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_ENDIAN_HPP
+#define JTC_TEMPLATES_ENDIAN_HPP
+
+#include "cv_ref_traits.hpp"
+#include "make_signed_unsigned.hpp"
+#include "number_traits.hpp"
+#include "std_def.hpp"
+#include "std_int.hpp"
+
+// The target's byte order. Define JTC_BIG_ENDIAN as 1 or 0 on compilers that don't report it.
+#ifndef JTC_BIG_ENDIAN
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define JTC_BIG_ENDIAN 1
+#else
+#define JTC_BIG_ENDIAN 0
+#endif
+#endif
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// Byte order
+//
+// Emulates C++20's std::endian, with endian::native set from JTC_BIG_ENDIAN.
+//-------------------------------------------------------------------------------------------------
+
+enum class endian { little, big, native = JTC_BIG_ENDIAN ? big : little };
+
+//-------------------------------------------------------------------------------------------------
+// Byte swapping
+//
+// Emulates C++23's std::byteswap for integral types, using the compiler intrinsics (a single
+//   bswap/rev instruction) where available.
+//
+// Usage:
+//     static_assert(byteswap(uint16_t(0x1234)) == 0x3412, "Should be 0x3412");
+//-------------------------------------------------------------------------------------------------
+
+// Forward declaration of the implementation
+namespace detail { template <size_t Size> struct byteswap_impl; }
+
+template <typename T>
+constexpr T byteswap(T value) {
+  static_assert(is_integral_v<T>(), "byteswap requires an integral type.");
+  return static_cast<T>(detail::byteswap_impl<sizeof(T)>::swap(static_cast<make_unsigned_t<remove_cv_t<T>>>(value)));
+}
+
+//-------------------------------------------------------------------------------------------------
+// Loads and stores
+//
+// load_endian<T, Order>(p) reads a T stored in the byte order Order at the address p, with any alignment.
+// store_endian<Order>(p, value) writes value at p in the byte order Order.
+// Both compile to a single (possibly unaligned) memory access, plus a byte swap when Order isn't native.
+//
+// Usage:
+//     uint32_t length = load_endian<uint32_t, endian::big>(packet + 4);
+//     store_endian<endian::little>(reply, uint16_t(0xCAFE));
+//-------------------------------------------------------------------------------------------------
+
+template <typename T, endian Order>
+inline T load_endian(const void* source) {
+  static_assert(is_integral_v<T>(), "load_endian requires an integral type.");
+  T value;
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_memcpy(&value, source, sizeof(T));
+#else
+  for (size_t i = 0; i < sizeof(T); i++) reinterpret_cast<unsigned char*>(&value)[i] = static_cast<const unsigned char*>(source)[i];
+#endif
+  return Order == endian::native ? value : byteswap(value);
+}
+
+template <endian Order, typename T>
+inline void store_endian(void* destination, T value) {
+  static_assert(is_integral_v<T>(), "store_endian requires an integral type.");
+  const T ordered = Order == endian::native ? value : byteswap(value);
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_memcpy(destination, &ordered, sizeof(T));
+#else
+  for (size_t i = 0; i < sizeof(T); i++) static_cast<unsigned char*>(destination)[i] = reinterpret_cast<const unsigned char*>(&ordered)[i];
+#endif
+}
+
+//-------------------------------------------------------------------------------------------------
+// byteswap implementation
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+template <>
+struct byteswap_impl<1> {
+  constexpr static uint8_t swap(uint8_t value) { return value; }
+};
+
+#if defined(__GNUC__) || defined(__clang__)
+
+template <>
+struct byteswap_impl<2> {
+  constexpr static uint16_t swap(uint16_t value) { return __builtin_bswap16(value); }
+};
+
+template <>
+struct byteswap_impl<4> {
+  constexpr static uint32_t swap(uint32_t value) { return __builtin_bswap32(value); }
+};
+
+template <>
+struct byteswap_impl<8> {
+  constexpr static uint64_t swap(uint64_t value) { return __builtin_bswap64(value); }
+};
+
+#else
+
+template <>
+struct byteswap_impl<2> {
+  constexpr static uint16_t swap(uint16_t value) { return static_cast<uint16_t>((value << 8) | (value >> 8)); }
+};
+
+template <>
+struct byteswap_impl<4> {
+  constexpr static uint32_t swap(uint32_t value) {
+    return (value << 24) | ((value << 8) & 0x00FF0000u) | ((value >> 8) & 0x0000FF00u) | (value >> 24);
+  }
+};
+
+template <>
+struct byteswap_impl<8> {
+  constexpr static uint64_t swap(uint64_t value) {
+    return (uint64_t(byteswap_impl<4>::swap(static_cast<uint32_t>(value))) << 32) |
+           byteswap_impl<4>::swap(static_cast<uint32_t>(value >> 32));
+  }
+};
+
+#endif
+
+}  // namespace detail
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+struct endian_tests {
+  static_assert(jtc::byteswap(jtc::uint8_t(0x12)) == 0x12, "JTC test failed!");
+  static_assert(jtc::byteswap(jtc::uint16_t(0x1234)) == 0x3412, "JTC test failed!");
+  static_assert(jtc::byteswap(jtc::uint32_t(0x12345678)) == 0x78563412, "JTC test failed!");
+  static_assert(jtc::byteswap(jtc::uint64_t(0x0102030405060708)) == 0x0807060504030201, "JTC test failed!");
+  static_assert(jtc::byteswap(jtc::int16_t(-2)) == jtc::int16_t(0xFEFF), "JTC test failed!");
+  static_assert(jtc::endian::native == jtc::endian::little || jtc::endian::native == jtc::endian::big, "JTC test failed!");
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
@@ -0,0 +1,146 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// event_bus.hpp: Static publish/subscribe, with subscribers resolved at compile time
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_EVENT_BUS_HPP
+#define JTC_TEMPLATES_EVENT_BUS_HPP
+
+#include "conditional.hpp"
+#include "result_type.hpp"
+#include "std_def.hpp"
+#include "type_list.hpp"
+#include "type_map.hpp"
+#include "typed_storage.hpp"
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// event_bus definition
+//
+// event_bus<type_map<map_node<Event, type_list<Handlers...>>...>> delivers each Event to its
+//   Handlers, in list order. The subscriptions are resolved at compile time: publish(e) expands into
+//   direct calls to handler(e) for exactly the subscribed handlers, which the compiler can inline.
+//   There are no virtual calls, no runtime registration and no heap allocations.
+//
+// The bus holds one instance of each handler type, default-constructed, so handlers may have state.
+//   A handler subscribed to many events is a single instance, with one operator() per event.
+// Publishing an event without subscribers does nothing.
+//
+// Usage:
+//     struct button_pressed {}; struct battery_low { int percent; };
+//     struct display { void operator()(const button_pressed&); void operator()(const battery_low&); };
+//     struct logger  { void operator()(const battery_low& e); };
+//
+//     event_bus<type_map<map_node<button_pressed, type_list<display>>,
+//                        map_node<battery_low, type_list<logger, display>>>> bus;
+//     bus.publish(battery_low{15});  // logger(e), then display(e)
+//-------------------------------------------------------------------------------------------------
+
+// Forward declaration of the implementation
+namespace detail {
+template <typename Map> struct event_bus_handlers;
+template <typename Storage, typename Handlers> struct event_bus_dispatch;
+}  // namespace detail
+
+template <typename Map>
+class event_bus {
+  static_assert(detail::event_bus_handlers<Map>::type::size > 0,
+                "An event_bus requires at least one subscribed handler.");
+
+ public:
+  /// All handler types, without duplicates
+  using handlers = typename detail::event_bus_handlers<Map>::type;
+
+  /// Handlers subscribed to Event, or an empty list
+  template <typename Event>
+  using subscribers_t = typename conditional_t<map_has_key<Map, Event>(), map_get<Map, Event>,
+                                               result_type<true, type_list<>>>::type;
+
+  /// Whether Event has any subscriber
+  template <typename Event>
+  constexpr static bool has_subscribers() { return subscribers_t<Event>::size != 0; }
+
+  /// Delivers event to all its subscribers, in order
+  template <typename Event>
+  void publish(const Event& event) {
+    detail::event_bus_dispatch<storage, subscribers_t<Event>>::call(storage_, event);
+  }
+
+  /// The instance of Handler
+  template <typename Handler>
+  Handler& handler() { return storage_.template get<Handler>(); }
+
+  template <typename Handler>
+  const Handler& handler() const { return storage_.template get<Handler>(); }
+
+ private:
+  template <typename List> struct storage_of;
+  template <typename... Handlers>
+  struct storage_of<type_list<Handlers...>> : make_type<typed_storage<Handlers...>> {};
+
+  using storage = typename storage_of<handlers>::type;
+
+  storage storage_;
+};
+
+//-------------------------------------------------------------------------------------------------
+// Implementation
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+template <typename... Nodes>
+struct event_bus_handlers<type_map<Nodes...>>
+    : list_unique<list_concat_t<type_list<>, typename Nodes::type...>> {};
+
+/// Calls every handler, left to right, through a pack expansion
+template <typename Storage, typename... Handlers>
+struct event_bus_dispatch<Storage, type_list<Handlers...>> {
+  template <typename Event>
+  static void call(Storage& storage, const Event& event) {
+    using expand = int[];
+    (void)expand{0, (storage.template get<Handlers>()(event), 0)...};
+  }
+};
+
+}  // namespace detail
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+namespace event_bus_helpers {
+struct started {}; struct stopped {}; struct unused {};
+struct counter { void operator()(const started&) {} void operator()(const stopped&) {} };
+struct logger { void operator()(const started&) {} };
+
+using bus = jtc::event_bus<jtc::type_map<jtc::map_node<started, jtc::type_list<logger, counter>>,
+                                         jtc::map_node<stopped, jtc::type_list<counter>>>>;
+}  // namespace event_bus_helpers
+
+struct event_bus_tests {
+  using bus = event_bus_helpers::bus;
+  using logger = event_bus_helpers::logger;
+  using counter = event_bus_helpers::counter;
+
+  static_assert(jtc::is_same_v<bus::handlers, jtc::type_list<logger, counter>>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<bus::subscribers_t<event_bus_helpers::stopped>, jtc::type_list<counter>>(), "JTC test failed!");
+  static_assert(bus::has_subscribers<event_bus_helpers::started>(), "JTC test failed!");
+  static_assert(!bus::has_subscribers<event_bus_helpers::unused>(), "JTC test failed!");
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
@@ -0,0 +1,381 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// fixed_point.hpp: Binary fixed-point arithmetic types, for targets without a floating-point unit
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_FIXED_POINT_HPP
+#define JTC_TEMPLATES_FIXED_POINT_HPP
+
+#include "conditional.hpp"
+#include "enable_if.hpp"
+#include "integer_width.hpp"
+#include "integral_constant.hpp"
+#include "is_same.hpp"
+#include "make_signed_unsigned.hpp"
+#include "number_traits.hpp"
+#include "std_def.hpp"
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// Policies
+//
+// Rounding policies define how bits below the result's precision are handled:
+//   - truncate: discards them, i.e. rounds toward negative infinity (toward zero, for division).
+//   - round: rounds to the nearest representable value.
+//
+// Overflow policies define what happens when a result doesn't fit the format:
+//   - wrap: no checks. The result wraps around the storage type.
+//   - saturate: the result is clamped to the largest or smallest representable value.
+//-------------------------------------------------------------------------------------------------
+
+namespace fixed_policy {
+struct truncate {};
+struct round {};
+struct wrap {};
+struct saturate {};
+}  // namespace fixed_policy
+
+//-------------------------------------------------------------------------------------------------
+// fixed_point declaration
+//
+// A number with IntBits integer bits and FracBits fractional bits, stored in the smallest integer
+//   type of std_int.hpp with at least IntBits + FracBits bits. For signed types, IntBits includes the sign bit.
+// Multiplications and divisions are computed in the integer type twice as wide as the storage,
+//   so the total width is limited to 32 bits.
+//
+// Usage:
+//     using q16 = fixed<16, 16>;                                     // Stored in int32_t
+//     using q15 = fixed<1, 15, fixed_policy::round, fixed_policy::saturate>;  // Stored in int16_t
+//
+//     constexpr q16 a(1.5), b(2);                                    // Conversions are constexpr
+//     static_assert(a * b == q16(3), "Should be 3");
+//     static_assert(q15(0.9) + q15(0.9) == q15::max(), "Should saturate");
+//
+// Right shifts of negative values are assumed to be arithmetic, as in all mainstream compilers.
+//-------------------------------------------------------------------------------------------------
+
+// Forward declaration of the implementation
+namespace detail { template <bool Signed, size_t IntBits, size_t FracBits, typename Rounding, typename Overflow> struct fixed_point_ops; }
+
+template <bool Signed, size_t IntBits, size_t FracBits, typename Rounding = fixed_policy::truncate,
+          typename Overflow = fixed_policy::wrap>
+class fixed_point {
+  static_assert(IntBits + FracBits > 0, "A fixed-point type must have at least one bit.");
+  static_assert(IntBits + FracBits <= 32, "Fixed-point types are limited to 32 bits, to allow a 64-bit intermediate.");
+  static_assert(!Signed || IntBits > 0, "Signed fixed-point types need at least one integer bit, for the sign.");
+
+  using ops = detail::fixed_point_ops<Signed, IntBits, FracBits, Rounding, Overflow>;
+
+ public:
+  /// Storage type
+  using rep = typename ops::rep;
+  /// Format properties
+  constexpr static size_t integer_bits = IntBits;
+  constexpr static size_t fractional_bits = FracBits;
+
+  /// Zero-initialized
+  constexpr fixed_point() : raw_(0) {}
+
+  /// Conversion from integers
+  template <typename T, enable_if_t<is_integral_v<T>(), int> = 0>
+  constexpr explicit fixed_point(T value) : raw_(ops::narrow(ops::from_integer(value))) {}
+
+  /// Conversion from floating-point numbers. Always saturates.
+  /// Mostly intended for compile-time constants: at runtime, it's as slow as the platform's floating-point.
+  template <typename T, enable_if_t<is_floating_point_v<T>(), int> = 0>
+  constexpr explicit fixed_point(T value) : raw_(ops::from_floating(value)) {}
+
+  /// Conversion from other fixed-point formats, applying this type's policies
+  template <bool S, size_t I, size_t F, typename R, typename O>
+  constexpr explicit fixed_point(fixed_point<S, I, F, R, O> other)
+      : raw_(ops::narrow(ops::template from_format<F>(static_cast<int64_t>(other.raw())))) {}
+
+  /// Creates a number from its internal representation
+  constexpr static fixed_point from_raw(rep raw) { return fixed_point(raw, raw_tag{}); }
+
+  /// Internal representation
+  constexpr rep raw() const { return raw_; }
+
+  /// Conversion to integers, using the rounding policy
+  template <typename T, enable_if_t<is_integral_v<T>(), int> = 0>
+  constexpr explicit operator T() const {
+    return static_cast<T>(ops::shift_right(static_cast<typename ops::signed_wide>(raw_), FracBits));
+  }
+
+  /// Conversion to floating-point numbers
+  template <typename T, enable_if_t<is_floating_point_v<T>(), int> = 0>
+  constexpr explicit operator T() const {
+    return static_cast<T>(raw_) / static_cast<T>(ops::scale);
+  }
+
+  /// Limits of the format
+  constexpr static fixed_point max() { return from_raw(static_cast<rep>(ops::max_raw)); }
+  constexpr static fixed_point lowest() { return from_raw(static_cast<rep>(ops::min_raw)); }
+  constexpr static fixed_point epsilon() { return from_raw(1); }
+
+  //-----------------------------------------------------------------------------------------------
+  // Arithmetic
+  //-----------------------------------------------------------------------------------------------
+
+  constexpr fixed_point operator+() const { return *this; }
+
+  constexpr fixed_point operator-() const {
+    static_assert(Signed, "Negation is only defined for signed fixed-point types.");
+    return from_raw(ops::narrow(-static_cast<typename ops::signed_wide>(raw_)));
+  }
+
+  friend constexpr fixed_point operator+(fixed_point a, fixed_point b) {
+    return from_raw(ops::narrow(static_cast<typename ops::signed_wide>(a.raw_) + b.raw_));
+  }
+
+  friend constexpr fixed_point operator-(fixed_point a, fixed_point b) {
+    return from_raw(ops::narrow(static_cast<typename ops::signed_wide>(a.raw_) - b.raw_));
+  }
+
+  friend constexpr fixed_point operator*(fixed_point a, fixed_point b) {
+    return from_raw(ops::narrow(ops::shift_right(static_cast<typename ops::wide>(a.raw_) * b.raw_, FracBits)));
+  }
+
+  /// Division by zero is undefined, as in integer division
+  friend constexpr fixed_point operator/(fixed_point a, fixed_point b) {
+    return from_raw(ops::narrow(ops::divide(static_cast<typename ops::wide>(a.raw_ * ops::scale),
+                                            static_cast<typename ops::wide>(b.raw_))));
+  }
+
+  fixed_point& operator+=(fixed_point other) { return *this = *this + other; }
+  fixed_point& operator-=(fixed_point other) { return *this = *this - other; }
+  fixed_point& operator*=(fixed_point other) { return *this = *this * other; }
+  fixed_point& operator/=(fixed_point other) { return *this = *this / other; }
+
+  //-----------------------------------------------------------------------------------------------
+  // Comparison
+  //-----------------------------------------------------------------------------------------------
+
+  friend constexpr bool operator==(fixed_point a, fixed_point b) { return a.raw_ == b.raw_; }
+  friend constexpr bool operator!=(fixed_point a, fixed_point b) { return a.raw_ != b.raw_; }
+  friend constexpr bool operator<(fixed_point a, fixed_point b) { return a.raw_ < b.raw_; }
+  friend constexpr bool operator<=(fixed_point a, fixed_point b) { return a.raw_ <= b.raw_; }
+  friend constexpr bool operator>(fixed_point a, fixed_point b) { return a.raw_ > b.raw_; }
+  friend constexpr bool operator>=(fixed_point a, fixed_point b) { return a.raw_ >= b.raw_; }
+
+ private:
+  struct raw_tag {};
+  constexpr fixed_point(rep raw, raw_tag) : raw_(raw) {}
+
+  rep raw_;
+};
+
+/// Signed fixed-point number. IntBits includes the sign bit, e.g. fixed<1, 15> is Q15.
+template <size_t IntBits, size_t FracBits, typename Rounding = fixed_policy::truncate,
+          typename Overflow = fixed_policy::wrap>
+using fixed = fixed_point<true, IntBits, FracBits, Rounding, Overflow>;
+
+/// Unsigned fixed-point number
+template <size_t IntBits, size_t FracBits, typename Rounding = fixed_policy::truncate,
+          typename Overflow = fixed_policy::wrap>
+using ufixed = fixed_point<false, IntBits, FracBits, Rounding, Overflow>;
+
+//-------------------------------------------------------------------------------------------------
+// fixed_point implementation: operations on the internal representation
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+template <bool Signed, size_t IntBits, size_t FracBits, typename Rounding, typename Overflow>
+struct fixed_point_ops {
+  constexpr static size_t total_bits = IntBits + FracBits;
+  constexpr static bool rounds = is_same_v<Rounding, fixed_policy::round>();
+  constexpr static bool saturates = is_same_v<Overflow, fixed_policy::saturate>();
+
+  /// Storage type
+  using rep = conditional_t<Signed, int_least_t<total_bits>, uint_least_t<total_bits>>;
+  /// Product type: holds the product of any two representations
+  using wide = make_wider_t<rep>;
+  /// Sum type: holds sums and differences of any two representations, including negative ones
+  using signed_wide = make_signed_t<wide>;
+
+  /// Representation range of the format, which may be narrower than the storage type
+  constexpr static signed_wide max_raw = Signed ? static_cast<signed_wide>((signed_wide(1) << (total_bits - 1)) - 1)
+                                                : static_cast<signed_wide>((signed_wide(1) << total_bits) - 1);
+  constexpr static signed_wide min_raw = Signed ? static_cast<signed_wide>(-max_raw - 1) : 0;
+
+  /// Representation of 1
+  constexpr static wide scale = static_cast<wide>(wide(1) << FracBits);
+
+  /// Whether w is below the minimum. Unsigned values never are.
+  template <typename W>
+  constexpr static bool below_min(W w, true_type) { return w < static_cast<W>(min_raw); }
+  template <typename W>
+  constexpr static bool below_min(W, false_type) { return false; }
+
+  /// Applies the overflow policy to an intermediate result
+  template <typename W>
+  constexpr static rep narrow(W w) {
+    return static_cast<rep>(!saturates                                       ? w
+                            : w > static_cast<W>(max_raw)                    ? static_cast<W>(max_raw)
+                            : below_min(w, bool_constant<is_signed_v<W>()>{}) ? static_cast<W>(min_raw)
+                                                                             : w);
+  }
+
+  /// Removes 'bits' fractional bits, using the rounding policy
+  template <typename W>
+  constexpr static W shift_right(W w, size_t bits) {
+    return bits == 0 ? w
+                     : rounds ? static_cast<W>((w + static_cast<W>(W(1) << (bits == 0 ? 0 : bits - 1))) >> bits)
+                              : static_cast<W>(w >> bits);
+  }
+
+  /// Divides, using the rounding policy. Rounding to nearest rounds ties away from zero.
+  template <typename W>
+  constexpr static W divide(W n, W d) {
+    return !rounds ? static_cast<W>(n / d)
+                   : static_cast<W>(((n < W(0)) == (d < W(0)) ? n + d / 2 : n - d / 2) / d);
+  }
+
+  /// Range of the integer part
+  constexpr static signed_wide max_integer = max_raw / static_cast<signed_wide>(scale);
+  constexpr static signed_wide min_integer = min_raw / static_cast<signed_wide>(scale);
+
+  template <typename T>
+  constexpr static bool above_max_integer(T value) {
+    return is_signed_v<T>() ? static_cast<int64_t>(value) > static_cast<int64_t>(max_integer)
+                            : static_cast<uint64_t>(value) > static_cast<uint64_t>(max_integer);
+  }
+
+  template <typename T>
+  constexpr static bool below_min_integer(T value) {
+    return is_signed_v<T>() && static_cast<int64_t>(value) < static_cast<int64_t>(min_integer);
+  }
+
+  /// Representation of an out of range integer, wrapped: the product is computed modulo 2^64
+  template <typename T>
+  constexpr static signed_wide wrap_integer(T value) {
+    return static_cast<signed_wide>(static_cast<uint64_t>(value) * (uint64_t(1) << FracBits));
+  }
+
+  /// Representation of an integer. It's range-checked first, as the product could overflow the intermediate.
+  template <typename T>
+  constexpr static signed_wide from_integer(T value) {
+    return above_max_integer(value)   ? (saturates ? max_raw : wrap_integer(value))
+           : below_min_integer(value) ? (saturates ? min_raw : wrap_integer(value))
+                                      : static_cast<signed_wide>(static_cast<signed_wide>(value) *
+                                                                 static_cast<signed_wide>(scale));
+  }
+
+  /// Representation of a number with F fractional bits, in a 64-bit intermediate, as formats may differ in width
+  template <size_t F>
+  constexpr static int64_t from_format(int64_t raw) {
+    return F > FracBits ? shift_right(raw, F > FracBits ? F - FracBits : 0)
+                        : raw * (int64_t(1) << (F > FracBits ? 0 : FracBits - F));
+  }
+
+  /// Floating-point to integer conversion, rounding down
+  template <typename T>
+  constexpr static signed_wide floor_floating(T value) {
+    return T(static_cast<signed_wide>(value)) > value ? static_cast<signed_wide>(value) - 1
+                                                      : static_cast<signed_wide>(value);
+  }
+
+  /// Non-negative floating-point to integer conversion, rounding ties up, as floor((floor(2 * value) + 1) / 2).
+  /// Adding 0.5 in T would round when T has no fractional bits left, e.g. for floats above 2^23.
+  template <typename T>
+  constexpr static signed_wide round_half_up(T value) { return (floor_floating(value * T(2)) + 1) >> 1; }
+
+  /// Floating-point to integer conversion, rounding to nearest, ties away from zero
+  template <typename T>
+  constexpr static signed_wide round_floating(T value) {
+    return value < T(0) ? -round_half_up(-value) : round_half_up(value);
+  }
+
+  /// Conversion of a value in [min_raw, max_raw + 1), which rounding to nearest may take to max_raw + 1
+  template <typename T>
+  constexpr static signed_wide convert_floating(T scaled) {
+    return rounds ? (round_floating(scaled) > max_raw ? max_raw : round_floating(scaled)) : floor_floating(scaled);
+  }
+
+  /// Representation of a floating-point number, saturated. NaN saturates to the maximum.
+  /// The range is checked against max_raw + 1 and min_raw, powers of two exactly representable in T:
+  ///   T(max_raw) itself may round up, e.g. to 2^31 in a float, which doesn't fit the storage.
+  template <typename T>
+  constexpr static rep from_floating(T value) {
+    return static_cast<rep>(!(value * T(scale) < T(max_raw + 1)) ? max_raw
+                            : value * T(scale) < T(min_raw)      ? min_raw
+                                                                 : convert_floating(value * T(scale)));
+  }
+};
+
+}  // namespace detail
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+struct fixed_point_tests {
+  using q16 = jtc::fixed<16, 16>;
+  using q8 = jtc::fixed<8, 8, jtc::fixed_policy::round>;
+  using q15 = jtc::fixed<1, 15, jtc::fixed_policy::round, jtc::fixed_policy::saturate>;
+  using uq4 = jtc::ufixed<4, 4, jtc::fixed_policy::truncate, jtc::fixed_policy::saturate>;
+
+  // Storage selection
+  static_assert(jtc::is_same_v<q16::rep, jtc::int32_t>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<q15::rep, jtc::int16_t>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<uq4::rep, jtc::uint8_t>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::fixed<10, 10>::rep, jtc::int32_t>(), "JTC test failed!");
+
+  // Conversions
+  static_assert(q16(1).raw() == 0x10000, "JTC test failed!");
+  static_assert(q16(-1.5).raw() == -0x18000, "JTC test failed!");
+  static_assert(static_cast<int>(q16(2.75)) == 2, "JTC test failed!");
+  static_assert(static_cast<int>(q16(-2.25)) == -3, "JTC test failed!");
+  static_assert(static_cast<int>(q8(2.5)) == 3, "JTC test failed!");
+  static_assert(static_cast<double>(q16(0.25)) == 0.25, "JTC test failed!");
+  static_assert(q16(q8(1.5)) == q16(1.5), "JTC test failed!");
+  static_assert(q8(q16(1.5)) == q8(1.5), "JTC test failed!");
+
+  // Arithmetic
+  static_assert(q16(1.5) + q16(2) == q16(3.5), "JTC test failed!");
+  static_assert(q16(1.5) - q16(2) == q16(-0.5), "JTC test failed!");
+  static_assert(q16(1.5) * q16(-2) == q16(-3), "JTC test failed!");
+  static_assert(q16(3) / q16(-2) == q16(-1.5), "JTC test failed!");
+  static_assert(-q16(1.25) == q16(-1.25), "JTC test failed!");
+  static_assert(q8(1) / q8(3) == q8::from_raw(85), "JTC test failed!");
+  static_assert(q8(2) / q8(3) == q8::from_raw(171), "JTC test failed!");
+
+  // Saturation
+  static_assert(q15(0.75) + q15(0.75) == q15::max(), "JTC test failed!");
+  static_assert(q15(-0.75) - q15(0.75) == q15::lowest(), "JTC test failed!");
+  static_assert(q15(-1) * q15(-1) == q15::max(), "JTC test failed!");
+  static_assert(q15(2.0) == q15::max(), "JTC test failed!");
+  static_assert(uq4(1) - uq4(2) == uq4::lowest(), "JTC test failed!");
+  static_assert(uq4(15) + uq4(1) == uq4::max(), "JTC test failed!");
+  static_assert(jtc::fixed<16, 16, jtc::fixed_policy::truncate, jtc::fixed_policy::saturate>(jtc::int64_t(1) << 50) ==
+                    jtc::fixed<16, 16, jtc::fixed_policy::truncate, jtc::fixed_policy::saturate>::max(),
+                "JTC test failed!");
+  static_assert(q15(-(jtc::int64_t(1) << 50)) == q15::lowest() && q15(1) == q15::max(), "JTC test failed!");
+  static_assert(uq4(~jtc::uint64_t(0)) == uq4::max() && uq4(-1) == uq4::lowest(), "JTC test failed!");
+
+  // Wrapping of out of range integers, without overflowing the intermediate
+  static_assert(q16(jtc::int64_t(1) << 50).raw() == 0, "JTC test failed!");
+  static_assert(q16(40000).raw() == -1673527296, "JTC test failed!");
+  static_assert(q16(-1) == q16(-1.0) && q16(-32768) == q16::lowest(), "JTC test failed!");
+
+  // Comparison
+  static_assert(q16(1) < q16(1.5) && q16(-1) < q16(0), "JTC test failed!");
+  static_assert(q16::epsilon().raw() == 1, "JTC test failed!");
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
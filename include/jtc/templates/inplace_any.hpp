@@ -0,0 +1,238 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// inplace_any.hpp: Type-erased values in a fixed inline buffer, without heap allocations or RTTI
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_INPLACE_ANY_HPP
+#define JTC_TEMPLATES_INPLACE_ANY_HPP
+
+#include "construct.hpp"
+#include "cv_ref_traits.hpp"
+#include "enable_if.hpp"
+#include "is_same.hpp"
+#include "move_forward.hpp"
+#include "span.hpp"
+#include "std_def.hpp"
+#include "type_id.hpp"
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// inplace_any definition
+//
+// inplace_any<Capacity, Align> holds a copyable value of any type up to Capacity bytes, aligned up to
+//   Align, stored inline. Storing a larger or more aligned type is a compile-time error, so it never
+//   allocates.
+//
+// Each stored type has a static vtable, generated at compile time, with its copy, move and destroy
+//   operations. The vtable pointer is the only per-value overhead, and also identifies the type:
+//   any_cast<T> compares it to T's vtable, a single pointer comparison, instead of using RTTI.
+//
+// Usage:
+//     using payload = inplace_any<32>;
+//     payload p = sample{12, 3.5f};
+//     if (sample* s = any_cast<sample>(&p)) process(*s);
+//     p.emplace<error>(error_code::timeout);
+//     span<const char> name = p.type_name();  // "error"
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+/// Type-erased operations of a stored type
+struct any_vtable {
+  void (*copy)(void* destination, const void* source);
+  void (*move)(void* destination, void* source);
+  void (*destroy)(void* value);
+  span<const char> name;
+};
+
+// Forward declaration of the implementation
+template <typename T> struct any_vtable_of;
+constexpr size_t any_default_align() { return alignof(long double) > alignof(void*) ? alignof(long double) : alignof(void*); }
+
+}  // namespace detail
+
+template <size_t Capacity, size_t Align = detail::any_default_align()>
+class inplace_any {
+  static_assert(Capacity > 0, "inplace_any requires a non-zero capacity.");
+
+  template <typename T>
+  using enable_if_value = enable_if_t<!is_same_v<remove_cvref_t<T>, inplace_any>()>;
+
+ public:
+  /// Whether a T can be stored
+  template <typename T>
+  constexpr static bool fits() { return sizeof(T) <= Capacity && alignof(T) <= Align; }
+
+  /// Empty
+  inplace_any() noexcept : vtable_(nullptr) {}
+
+  /// Holds a copy of value
+  template <typename T, typename = enable_if_value<T>>
+  inplace_any(T&& value) : vtable_(nullptr) {
+    emplace<remove_cvref_t<T>>(jtc::forward<T>(value));
+  }
+
+  inplace_any(const inplace_any& other) : vtable_(other.vtable_) {
+    if (vtable_ != nullptr) vtable_->copy(buffer_, other.buffer_);
+  }
+
+  inplace_any(inplace_any&& other) noexcept : vtable_(other.vtable_) {
+    if (vtable_ != nullptr) vtable_->move(buffer_, other.buffer_);
+  }
+
+  ~inplace_any() { reset(); }
+
+  inplace_any& operator=(const inplace_any& other) {
+    if (this != &other) {
+      reset();
+      if (other.vtable_ != nullptr) other.vtable_->copy(buffer_, other.buffer_);
+      vtable_ = other.vtable_;
+    }
+    return *this;
+  }
+
+  inplace_any& operator=(inplace_any&& other) noexcept {
+    if (this != &other) {
+      reset();
+      if (other.vtable_ != nullptr) other.vtable_->move(buffer_, other.buffer_);
+      vtable_ = other.vtable_;
+    }
+    return *this;
+  }
+
+  template <typename T, typename = enable_if_value<T>>
+  inplace_any& operator=(T&& value) {
+    emplace<remove_cvref_t<T>>(jtc::forward<T>(value));
+    return *this;
+  }
+
+  /// Replaces the value with a T constructed from args
+  template <typename T, typename... Args>
+  T& emplace(Args&&... args) {
+    static_assert(is_same_v<T, remove_cvref_t<T>>(), "inplace_any can't hold references or cv-qualified types.");
+    static_assert(sizeof(T) <= Capacity, "The type is too large for this inplace_any.");
+    static_assert(alignof(T) <= Align, "The type's alignment is too large for this inplace_any.");
+    reset();
+    T* value = jtc::construct_at(reinterpret_cast<T*>(buffer_), jtc::forward<Args>(args)...);
+    vtable_ = &detail::any_vtable_of<T>::value;
+    return *value;
+  }
+
+  /// Destroys the value
+  void reset() noexcept {
+    if (vtable_ != nullptr) {
+      vtable_->destroy(buffer_);
+      vtable_ = nullptr;
+    }
+  }
+
+  bool has_value() const noexcept { return vtable_ != nullptr; }
+
+  /// Whether the value is a T, ignoring cv-qualifiers
+  template <typename T>
+  bool is() const noexcept { return vtable_ == &detail::any_vtable_of<remove_cv_t<T>>::value; }
+
+  /// Name of the value's type, or an empty name
+  span<const char> type_name() const noexcept { return vtable_ != nullptr ? vtable_->name : span<const char>(); }
+
+  /// Pointer to the value, which must be a T
+  template <typename T>
+  T* get() noexcept { return reinterpret_cast<T*>(buffer_); }
+
+  template <typename T>
+  const T* get() const noexcept { return reinterpret_cast<const T*>(buffer_); }
+
+ private:
+  const detail::any_vtable* vtable_;
+  alignas(Align) unsigned char buffer_[Capacity];
+};
+
+//-------------------------------------------------------------------------------------------------
+// any_cast
+//
+// Pointer to the value of an inplace_any if it holds a T, nullptr otherwise. T may be cv-qualified,
+//   as in any_cast<const sample>(&p), to get a pointer to const.
+//-------------------------------------------------------------------------------------------------
+
+template <typename T, size_t Capacity, size_t Align>
+inline T* any_cast(inplace_any<Capacity, Align>* any) noexcept {
+  return any != nullptr && any->template is<T>() ? any->template get<T>() : nullptr;
+}
+
+template <typename T, size_t Capacity, size_t Align>
+inline const T* any_cast(const inplace_any<Capacity, Align>* any) noexcept {
+  return any != nullptr && any->template is<T>() ? any->template get<T>() : nullptr;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Implementation
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+template <typename T>
+struct any_vtable_of {
+  static void copy(void* destination, const void* source) {
+    jtc::construct_at(static_cast<T*>(destination), *static_cast<const T*>(source));
+  }
+
+  static void move(void* destination, void* source) {
+    jtc::construct_at(static_cast<T*>(destination), jtc::move(*static_cast<T*>(source)));
+  }
+
+  static void destroy(void* value) { jtc::destroy_at(static_cast<T*>(value)); }
+
+  constexpr static any_vtable value = {&copy, &move, &destroy, jtc::type_name<T>()};
+};
+
+template <typename T>
+constexpr any_vtable any_vtable_of<T>::value;
+
+}  // namespace detail
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+namespace inplace_any_helpers {
+template <typename T>
+constexpr const jtc::detail::any_vtable* vtable() { return &jtc::detail::any_vtable_of<T>::value; }
+
+constexpr bool equals(jtc::span<const char> s, const char* text, size_t i = 0) {
+  return i == s.size() ? text[i] == '\0' : s[i] == text[i] && equals(s, text, i + 1);
+}
+}  // namespace inplace_any_helpers
+
+struct inplace_any_tests {
+  static_assert(jtc::inplace_any<8, 8>::fits<jtc::uint64_t>(), "JTC test failed!");
+  static_assert(!jtc::inplace_any<8, 4>::fits<jtc::uint64_t>(), "JTC test failed!");
+  static_assert(!jtc::inplace_any<4>::fits<jtc::uint64_t>(), "JTC test failed!");
+  static_assert(sizeof(jtc::inplace_any<16, alignof(void*)>) == 16 + sizeof(void*), "JTC test failed!");
+
+  // is<T>() compares vtable addresses: each type has its own, shared by every inplace_any
+  static_assert(inplace_any_helpers::vtable<int>() == inplace_any_helpers::vtable<int>(), "JTC test failed!");
+  static_assert(inplace_any_helpers::vtable<int>() != inplace_any_helpers::vtable<unsigned>(), "JTC test failed!");
+  static_assert(inplace_any_helpers::vtable<int>() != inplace_any_helpers::vtable<jtc::uint64_t>(), "JTC test failed!");
+
+  // type_name() is the vtable's name
+  static_assert(inplace_any_helpers::vtable<double>()->name.size() == jtc::type_name<double>().size(), "JTC test failed!");
+#ifdef JTC_TYPE_SIGNATURE
+  static_assert(inplace_any_helpers::equals(inplace_any_helpers::vtable<double>()->name, "double"), "JTC test failed!");
+#endif
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
@@ -0,0 +1,142 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// integer_width.hpp: Selection of integer types by bit width, and widening of integer types
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_INTEGER_WIDTH_HPP
+#define JTC_TEMPLATES_INTEGER_WIDTH_HPP
+
+#include "conditional.hpp"
+#include "cv_ref_traits.hpp"
+#include "integral_constant.hpp"
+#include "is_same.hpp"
+#include "make_signed_unsigned.hpp"
+#include "result_type.hpp"
+#include "std_def.hpp"
+#include "std_int.hpp"
+#include "type_list.hpp"
+#include "type_map.hpp"
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// Smallest integer type with at least Bits bits
+//
+// Searches the fixed-width types, from the smallest to the largest.
+// The search result is a result_type, so it can be used in SFINAE when no type is wide enough.
+//
+// Usage:
+//     static_assert(is_same_v<int_least_t<12>, int16_t>(), "Should be int16_t");
+//     static_assert(is_same_v<uint_least_t<33>, uint64_t>(), "Should be uint64_t");
+//-------------------------------------------------------------------------------------------------
+
+// Forward declaration of the implementation
+namespace detail { template <size_t Bits> struct has_bits; }
+
+/// Search result of the smallest integer type with at least Bits bits, signed or unsigned
+template <size_t Bits, bool Signed = true>
+struct integer_least
+    : list_find_where<conditional_t<Signed, type_list<int8_t, int16_t, int32_t, int64_t>,
+                                    type_list<uint8_t, uint16_t, uint32_t, uint64_t>>,
+                      detail::has_bits<Bits>::template match> {};
+
+template <size_t Bits> using int_least_t  = typename integer_least<Bits, true>::type;
+template <size_t Bits> using uint_least_t = typename integer_least<Bits, false>::type;
+
+//-------------------------------------------------------------------------------------------------
+// Widening
+//
+// make_wider<T> is a result_type holding the integer type twice as wide as T, with the same signedness.
+// The widest type (64 bits) has no wider type: make_wider<int64_t>::value is false.
+//
+// Usage:
+//     static_assert(is_same_v<make_wider_t<uint16_t>, uint32_t>(), "Should be uint32_t");
+//     static_assert(!has_wider_v<int64_t>(), "There's no 128-bit standard type");
+//-------------------------------------------------------------------------------------------------
+
+// Forward declaration of the implementation
+namespace detail {
+using fixed_width_types = type_list<int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t, uint32_t, uint64_t>;
+template <typename T, bool = list_has_type<fixed_width_types, T>()> struct make_wider_impl;
+}  // namespace detail
+
+template <typename T> struct make_wider   : detail::make_wider_impl<remove_cv_t<T>> {};
+template <typename T> using  make_wider_t = typename make_wider<T>::type;
+
+/// Whether T has a wider integer type
+template <typename T>
+inline constexpr bool has_wider_v() { return make_wider<T>::value; }
+
+//-------------------------------------------------------------------------------------------------
+// Implementation
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+/// Search operator for integer_least
+template <size_t Bits>
+struct has_bits {
+  template <typename T>
+  using match = bool_constant<(sizeof(T) * 8 >= Bits)>;
+};
+
+/// Map of signed types to the signed type twice as wide.
+/// Unsigned types use the same map, through make_signed and make_unsigned.
+using widening_map = type_map<map_node<int8_t, int16_t>, map_node<int16_t, int32_t>, map_node<int32_t, int64_t>>;
+
+/// Converts the widening_map search Result back to the original signedness
+template <typename Result, bool Unsigned, bool Found = Result::value>
+struct widening_result : result_type<false> {};
+
+template <typename Result>
+struct widening_result<Result, false, true> : result_type<true, typename Result::type> {};
+
+template <typename Result>
+struct widening_result<Result, true, true> : result_type<true, make_unsigned_t<typename Result::type>> {};
+
+template <typename T>
+struct make_wider_impl<T, true> : widening_result<map_get<widening_map, make_signed_t<T>>, is_unsigned_v<T>()> {};
+
+template <typename T>
+struct make_wider_impl<T, false> : result_type<false> {};
+
+}  // namespace detail
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+struct integer_width_tests {
+  // Smallest types
+  static_assert(jtc::is_same_v<jtc::int_least_t<1>, jtc::int8_t>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::int_least_t<8>, jtc::int8_t>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::int_least_t<9>, jtc::int16_t>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::uint_least_t<17>, jtc::uint32_t>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::uint_least_t<64>, jtc::uint64_t>(), "JTC test failed!");
+  static_assert(!jtc::integer_least<65>::value, "JTC test failed!");
+
+  // Widening
+  static_assert(jtc::is_same_v<jtc::make_wider_t<jtc::int8_t>, jtc::int16_t>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::make_wider_t<jtc::int32_t>, jtc::int64_t>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::make_wider_t<jtc::uint16_t>, jtc::uint32_t>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::make_wider_t<const jtc::uint32_t>, jtc::uint64_t>(), "JTC test failed!");
+  static_assert(!jtc::has_wider_v<jtc::int64_t>(), "JTC test failed!");
+  static_assert(!jtc::has_wider_v<jtc::uint64_t>(), "JTC test failed!");
+  static_assert(!jtc::has_wider_v<float>(), "JTC test failed!");
+  static_assert(!jtc::has_wider_v<bool>(), "JTC test failed!");
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
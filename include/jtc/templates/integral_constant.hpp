@@ -49,16 +49,31 @@ using false_type = bool_constant<false>;
 // Compile-time Tests
 //-------------------------------------------------------------------------------------------------
 
-#ifndef JTC_NO_TESTS
+#ifdef JTC_TESTS
 
 namespace jtc {
 namespace tests {
 
-// TODO
+struct integral_constant_tests {
+  using three = jtc::integral_constant<int, 3>;
+
+  // Value, conversion and call
+  static_assert(three::value == 3, "JTC test failed!");
+  static_assert(three() == 3, "JTC test failed!");
+  static_assert(three()() == 3, "JTC test failed!");
+  static_assert(three::type::value == 3, "JTC test failed!");
+  static_assert(jtc::integral_constant<char, 'a'>::value == 'a', "JTC test failed!");
+  static_assert(sizeof(jtc::integral_constant<char, 'a'>::value_type) == 1, "JTC test failed!");
+
+  // Booleans
+  static_assert(jtc::true_type::value && !jtc::false_type::value, "JTC test failed!");
+  static_assert(jtc::bool_constant<(1 < 2)>(), "JTC test failed!");
+  static_assert(!jtc::bool_constant<false>()(), "JTC test failed!");
+};
 
 }  // namespace tests
 }  // namespace jtc
 
-#endif  // JTC_NO_TESTS
+#endif  // JTC_TESTS
 
 #endif
\ No newline at end of file
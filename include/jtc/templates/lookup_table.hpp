@@ -0,0 +1,147 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// lookup_table.hpp: Compile-time generation of constant lookup tables from constexpr generators
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_LOOKUP_TABLE_HPP
+#define JTC_TEMPLATES_LOOKUP_TABLE_HPP
+
+#include "integer_sequence.hpp"
+#include "std_def.hpp"
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// lookup_table definition
+//
+// A fixed-size aggregate array of N values of type T, usable in constant expressions.
+//
+// Usage:
+//     constexpr lookup_table<uint8_t, 3> table = {{1, 2, 3}};
+//     static_assert(table[1] == 2, "Should be 2");
+//-------------------------------------------------------------------------------------------------
+
+template <typename T, size_t N>
+struct lookup_table {
+  static_assert(N > 0, "A lookup_table must have at least one element.");
+
+  /// Type of the stored values
+  using value_type = T;
+
+  /// Table contents. Public, so the table stays an aggregate.
+  T values[N];
+
+  /// Number of elements in the table
+  constexpr static size_t size() { return N; }
+
+  /// Read-only element access, usable in constant expressions
+  constexpr const T& operator[](size_t index) const { return values[index]; }
+
+  /// Range-based for loop support
+  constexpr const T* begin() const { return values; }
+  constexpr const T* end() const { return values + N; }
+};
+
+//-------------------------------------------------------------------------------------------------
+// Table Generation
+//
+// Builds a lookup_table<T, N> where the element at index i is static_cast<T>(generator(i)).
+// The generator must be a literal type with a constexpr call operator taking a size_t.
+//
+// Usage:
+//     struct squares { constexpr uint16_t operator()(size_t i) const { return i * i; } };
+//     constexpr auto table = make_lookup_table<uint16_t, 16>(squares{});
+//     static_assert(table[15] == 225, "Should be 225");
+//-------------------------------------------------------------------------------------------------
+
+// Forward declaration of the implementation
+namespace detail {
+template <typename T, size_t N, typename Generator, size_t... Is>
+constexpr lookup_table<T, N> make_lookup_table_impl(const Generator& generator, index_sequence<Is...>);
+}
+
+/// Creates a lookup_table of N elements, calling generator(i) for each index in [0, N)
+template <typename T, size_t N, typename Generator>
+constexpr lookup_table<T, N> make_lookup_table(const Generator& generator) {
+  return detail::make_lookup_table_impl<T, N>(generator, make_index_sequence<N>{});
+}
+
+//-------------------------------------------------------------------------------------------------
+// Static Tables
+//
+// Holds the table generated by a default-constructed Generator in a constexpr static member,
+//   so there's a single instance of it per program, in read-only storage, computed at compile time.
+//
+// Usage:
+//     const auto& table = static_table<uint16_t, 16, squares>::value;
+//-------------------------------------------------------------------------------------------------
+
+template <typename T, size_t N, typename Generator>
+struct static_table {
+  /// The table, generated at compile time
+  constexpr static lookup_table<T, N> value = make_lookup_table<T, N>(Generator{});
+};
+
+// Out-of-class definition, required for ODR-use before C++17
+template <typename T, size_t N, typename Generator>
+constexpr lookup_table<T, N> static_table<T, N, Generator>::value;
+
+//-------------------------------------------------------------------------------------------------
+// make_lookup_table implementation: a pack expansion over the table indexes
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+template <typename T, size_t N, typename Generator, size_t... Is>
+constexpr lookup_table<T, N> make_lookup_table_impl(const Generator& generator, index_sequence<Is...>) {
+  return lookup_table<T, N>{{static_cast<T>(generator(Is))...}};
+}
+
+}  // namespace detail
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+// Generators used in the tests below
+namespace lookup_table_helpers {
+struct squares {
+  constexpr size_t operator()(size_t i) const { return i * i; }
+};
+
+struct identity {
+  constexpr size_t operator()(size_t i) const { return i; }
+};
+}  // namespace lookup_table_helpers
+
+struct lookup_table_tests {
+  using squares  = lookup_table_helpers::squares;
+  using identity = lookup_table_helpers::identity;
+
+  // Generated values
+  static_assert(jtc::make_lookup_table<unsigned short, 16>(squares{})[0] == 0, "JTC test failed!");
+  static_assert(jtc::make_lookup_table<unsigned short, 16>(squares{})[15] == 225, "JTC test failed!");
+
+  // Conversion to the element type
+  static_assert(jtc::make_lookup_table<unsigned char, 300>(identity{})[299] == 43, "JTC test failed!");
+
+  // Size
+  static_assert(jtc::lookup_table<int, 7>::size() == 7, "JTC test failed!");
+  static_assert(jtc::static_table<int, 5, identity>::value.size() == 5, "JTC test failed!");
+  static_assert(jtc::static_table<int, 5, identity>::value[4] == 4, "JTC test failed!");
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
@@ -71,7 +71,7 @@ template <typename T> struct make_signed_impl<T, false>   : make_type<copy_cv_t<
 // Compile-time Tests
 //-------------------------------------------------------------------------------------------------
 
-#ifndef JTC_NO_TESTS
+#ifdef JTC_TESTS
 
 namespace jtc {
 namespace tests {
@@ -81,6 +81,6 @@ namespace tests {
 }  // namespace tests
 }  // namespace jtc
 
-#endif  // JTC_NO_TESTS
+#endif  // JTC_TESTS
 
 #endif
\ No newline at end of file
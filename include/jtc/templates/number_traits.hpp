@@ -11,6 +11,7 @@
 #include "cv_ref_traits.hpp"
 #include "enable_if.hpp"
 #include "integral_constant.hpp"
+#include "is_same.hpp"
 #include "type_list.hpp"
 
 namespace jtc {
@@ -108,6 +109,36 @@ inline constexpr bool is_unsigned_v() noexcept {
   return is_unsigned<T>::value;
 }
 
+//-------------------------------------------------------------------------------------------------
+// is_widening
+//-------------------------------------------------------------------------------------------------
+
+// Whether every From value is a To value, i.e. the conversion never narrows:
+//  - Integers to integers of the same signedness and at least the same size, or to larger signed integers;
+//  - Integers to larger floating-point types;
+//  - Floating-point types to floating-point types at least as large.
+// Other types, e.g. class types, only to themselves.
+namespace detail {
+template <typename From, typename To>
+constexpr bool is_widening_impl() {
+  return is_same_v<From, To>() ||
+         (is_integral_v<From>() && is_integral_v<To>()
+              ? (is_signed_v<From>() == is_signed_v<To>() ? sizeof(To) >= sizeof(From)
+                                                          : is_signed_v<To>() && sizeof(To) > sizeof(From))
+          : is_integral_v<From>() && is_floating_point_v<To>()       ? sizeof(To) > sizeof(From)
+          : is_floating_point_v<From>() && is_floating_point_v<To>() ? sizeof(To) >= sizeof(From)
+                                                                     : false);
+}
+}  // namespace detail
+
+template <typename From, typename To>
+struct is_widening : bool_constant<detail::is_widening_impl<remove_cv_t<From>, remove_cv_t<To>>()> {};
+
+template <typename From, typename To>
+inline constexpr bool is_widening_v() noexcept {
+  return is_widening<From, To>::value;
+}
+
 }  // namespace jtc
 
 
@@ -115,7 +146,7 @@ inline constexpr bool is_unsigned_v() noexcept {
 // Compile-time Tests
 //-------------------------------------------------------------------------------------------------
 
-#ifndef JTC_NO_TESTS
+#ifdef JTC_TESTS
 
 namespace jtc {
 namespace tests {
@@ -125,6 +156,6 @@ namespace tests {
 }  // namespace tests
 }  // namespace jtc
 
-#endif  // JTC_NO_TESTS
+#endif  // JTC_TESTS
 
 #endif
\ No newline at end of file
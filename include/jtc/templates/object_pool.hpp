@@ -0,0 +1,257 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// object_pool.hpp: Fixed-capacity object pools, with O(1) acquire and release through an index free list
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_OBJECT_POOL_HPP
+#define JTC_TEMPLATES_OBJECT_POOL_HPP
+
+#include "construct.hpp"
+#include "enable_if.hpp"
+#include "integer_width.hpp"
+#include "is_same.hpp"
+#include "move_forward.hpp"
+#include "std_def.hpp"
+#include "type_list.hpp"
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// object_pool definition
+//
+// object_pool<T, N> holds storage for N objects of type T, inline: there are no heap allocations.
+// acquire(args...) constructs a T in a free slot, forwarding args to its constructor, and returns
+//   a pointer to it, or nullptr when the pool is full. release(p) destroys the object and frees its slot.
+// Both are O(1): free slots form an intrusive list, whose links are stored in the free slots
+//   themselves as slot indexes of type index_type, the smallest unsigned type holding N.
+//   Slots are taken in order the first time, so construction doesn't walk the storage.
+//
+// The pool doesn't track live objects: release every object before the pool is destroyed.
+//
+// Usage:
+//     object_pool<message, 64> pool;   // index_type is uint8_t
+//     message* m = pool.acquire(id, payload);
+//     if (m != nullptr) { send(*m); pool.release(m); }
+//-------------------------------------------------------------------------------------------------
+
+// Forward declaration of the implementation
+namespace detail {
+template <size_t Size, size_t Align, size_t N> class pool_storage;
+constexpr size_t pool_index_bits(size_t max_index) { return max_index <= 1 ? 1 : 1 + pool_index_bits(max_index >> 1); }
+constexpr size_t pool_max() { return 0; }
+template <typename... Sizes>
+constexpr size_t pool_max(size_t size, Sizes... sizes) { return size > pool_max(sizes...) ? size : pool_max(sizes...); }
+}  // namespace detail
+
+template <typename T, size_t N>
+class object_pool {
+  using storage = detail::pool_storage<sizeof(T), alignof(T), N>;
+
+ public:
+  using value_type = T;
+
+  /// Slot index type. N is the null index.
+  using index_type = typename storage::index_type;
+
+  /// Maximum number of objects
+  constexpr static size_t capacity() { return N; }
+
+  /// Number of live objects
+  size_t size() const { return storage_.size(); }
+
+  bool empty() const { return storage_.size() == 0; }
+  bool full() const { return storage_.size() == N; }
+
+  /// Constructs a T from args in a free slot. Returns nullptr when the pool is full.
+  template <typename... Args>
+  T* acquire(Args&&... args) {
+    void* slot = storage_.allocate();
+    return slot == nullptr ? nullptr : jtc::construct_at(static_cast<T*>(slot), jtc::forward<Args>(args)...);
+  }
+
+  /// Destroys the object at p, which must have been acquired from this pool
+  void release(T* p) {
+    jtc::destroy_at(p);
+    storage_.deallocate(p);
+  }
+
+  /// Whether p points to a slot of this pool
+  bool owns(const T* p) const { return storage_.owns(p); }
+
+  /// Index of the slot of p, e.g. to store compact handles
+  index_type index_of(const T* p) const { return storage_.index_of(p); }
+
+  /// Object at the slot index, which must be live
+  T& operator[](index_type index) { return *static_cast<T*>(storage_.slot(index)); }
+  const T& operator[](index_type index) const { return *static_cast<const T*>(storage_.slot(index)); }
+
+ private:
+  storage storage_;
+};
+
+//-------------------------------------------------------------------------------------------------
+// multi_pool definition
+//
+// multi_pool<type_list<Ts...>, N> is a pool of N slots shared by the types Ts: the slot size and
+//   alignment are the maximum of all types, so any slot can hold any of them.
+// acquire<T>(args...) and release(p) behave as in object_pool. Acquiring a type that's not in the
+//   list is a compile-time error, and release only accepts pointers to the listed types.
+//
+// Usage:
+//     multi_pool<type_list<ping, data, error>, 32> pool;
+//     data* d = pool.acquire<data>(buffer, size);
+//     pool.release(d);
+//-------------------------------------------------------------------------------------------------
+
+template <typename Types, size_t N>
+class multi_pool;
+
+template <typename... Ts, size_t N>
+class multi_pool<type_list<Ts...>, N> {
+  static_assert(sizeof...(Ts) > 0, "A multi_pool requires at least one type.");
+
+  using storage = detail::pool_storage<detail::pool_max(sizeof(Ts)...), detail::pool_max(alignof(Ts)...), N>;
+
+ public:
+  using types = type_list<Ts...>;
+  using index_type = typename storage::index_type;
+
+  /// Size and alignment of the slots
+  constexpr static size_t slot_size() { return detail::pool_max(sizeof(Ts)...); }
+  constexpr static size_t slot_alignment() { return detail::pool_max(alignof(Ts)...); }
+
+  constexpr static size_t capacity() { return N; }
+  size_t size() const { return storage_.size(); }
+  bool empty() const { return storage_.size() == 0; }
+  bool full() const { return storage_.size() == N; }
+
+  /// Constructs a T from args in a free slot. Returns nullptr when the pool is full.
+  template <typename T, typename... Args>
+  T* acquire(Args&&... args) {
+    static_assert(list_has_type<types, T>(), "Type not found in the multi_pool list.");
+    void* slot = storage_.allocate();
+    return slot == nullptr ? nullptr : jtc::construct_at(static_cast<T*>(slot), jtc::forward<Args>(args)...);
+  }
+
+  /// Destroys the object at p, which must have been acquired from this pool as a T
+  template <typename T, enable_if_t<list_has_type<type_list<Ts...>, T>(), int> = 0>
+  void release(T* p) {
+    jtc::destroy_at(p);
+    storage_.deallocate(p);
+  }
+
+  bool owns(const void* p) const { return storage_.owns(p); }
+  index_type index_of(const void* p) const { return storage_.index_of(p); }
+
+ private:
+  storage storage_;
+};
+
+//-------------------------------------------------------------------------------------------------
+// Implementation
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+/// N raw slots of Size bytes, aligned to Align, with an intrusive free list
+template <size_t Size, size_t Align, size_t N>
+class pool_storage {
+  static_assert(N > 0, "A pool requires at least one slot.");
+
+ public:
+  using index_type = uint_least_t<pool_index_bits(N)>;
+
+  pool_storage() : free_(N), unused_(0), size_(0) {}
+
+  pool_storage(const pool_storage&) = delete;
+  pool_storage& operator=(const pool_storage&) = delete;
+
+  size_t size() const { return size_; }
+
+  /// A free slot, or nullptr
+  void* allocate() {
+    if (free_ != N) {
+      void* p = slot(free_);
+      free_ = *static_cast<index_type*>(p);
+      size_++;
+      return p;
+    }
+    if (unused_ != N) {
+      size_++;
+      return slot(unused_++);
+    }
+    return nullptr;
+  }
+
+  /// Pushes the slot at p to the free list
+  void deallocate(void* p) {
+    jtc::construct_at(static_cast<index_type*>(p), free_);
+    free_ = index_of(p);
+    size_--;
+  }
+
+  void* slot(size_t index) { return slots_[index].bytes; }
+  const void* slot(size_t index) const { return slots_[index].bytes; }
+
+  bool owns(const void* p) const {
+    const unsigned char* byte = static_cast<const unsigned char*>(p);
+    const unsigned char* begin = slots_[0].bytes;
+    return byte >= begin && byte < begin + sizeof(slots_) && (byte - begin) % sizeof(slot_type) == 0;
+  }
+
+  index_type index_of(const void* p) const {
+    return static_cast<index_type>((static_cast<const unsigned char*>(p) - slots_[0].bytes) / sizeof(slot_type));
+  }
+
+ private:
+  /// A slot holds an object, or the index of the next free slot
+  struct slot_type {
+    alignas(Align > alignof(index_type) ? Align : alignof(index_type))
+        unsigned char bytes[Size > sizeof(index_type) ? Size : sizeof(index_type)];
+  };
+
+  slot_type slots_[N];
+  index_type free_;    // Head of the free list
+  index_type unused_;  // First slot never allocated
+  index_type size_;
+};
+
+}  // namespace detail
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+namespace object_pool_helpers {
+struct message { jtc::uint16_t words[5]; };
+}  // namespace object_pool_helpers
+
+struct object_pool_tests {
+  // Index types
+  static_assert(jtc::is_same_v<jtc::object_pool<int, 255>::index_type, jtc::uint8_t>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::object_pool<int, 256>::index_type, jtc::uint16_t>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::object_pool<char, 70000>::index_type, jtc::uint32_t>(), "JTC test failed!");
+
+  // Slots hold an object or a link
+  static_assert(sizeof(jtc::object_pool<jtc::uint8_t, 100>) == 100 + 3, "JTC test failed!");
+  static_assert(sizeof(jtc::object_pool<char, 1000>) == 2000 + 6, "JTC test failed!");
+
+  // Shared slots
+  using multi = jtc::multi_pool<jtc::type_list<char, jtc::uint32_t, object_pool_helpers::message>, 8>;
+  static_assert(multi::slot_size() == 10 && multi::slot_alignment() == 4, "JTC test failed!");
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
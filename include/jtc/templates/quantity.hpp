@@ -0,0 +1,484 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// quantity.hpp: Physical quantities with units checked at compile time, and conversions folded into constants
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_QUANTITY_HPP
+#define JTC_TEMPLATES_QUANTITY_HPP
+
+#include "conditional.hpp"
+#include "enable_if.hpp"
+#include "fixed_point.hpp"
+#include "integer_width.hpp"
+#include "integral_constant.hpp"
+#include "is_same.hpp"
+#include "make_type.hpp"
+#include "number_traits.hpp"
+#include "ratio.hpp"
+#include "std_def.hpp"
+#include "std_int.hpp"
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// Dimensions
+//
+// A dimension is a list of exponents of the base dimensions: length, mass, time, current and temperature.
+// Multiplying and dividing quantities adds and subtracts the exponents.
+//
+// Usage:
+//     using velocity = dimension_divide_t<dimensions::length, dimensions::time>;  // dimension<1, 0, -1, 0, 0>
+//-------------------------------------------------------------------------------------------------
+
+template <int... Exponents>
+struct dimension {};
+
+template <typename D1, typename D2> struct dimension_multiply;
+template <typename D1, typename D2> struct dimension_divide;
+
+template <int... As, int... Bs>
+struct dimension_multiply<dimension<As...>, dimension<Bs...>> : make_type<dimension<(As + Bs)...>> {};
+
+template <int... As, int... Bs>
+struct dimension_divide<dimension<As...>, dimension<Bs...>> : make_type<dimension<(As - Bs)...>> {};
+
+template <typename D1, typename D2> using dimension_multiply_t = typename dimension_multiply<D1, D2>::type;
+template <typename D1, typename D2> using dimension_divide_t   = typename dimension_divide<D1, D2>::type;
+
+namespace dimensions {
+//                        length, mass, time, current, temperature
+using dimensionless = dimension<0, 0,  0,  0, 0>;
+using length        = dimension<1, 0,  0,  0, 0>;
+using mass          = dimension<0, 1,  0,  0, 0>;
+using time          = dimension<0, 0,  1,  0, 0>;
+using current       = dimension<0, 0,  0,  1, 0>;
+using temperature   = dimension<0, 0,  0,  0, 1>;
+using frequency     = dimension<0, 0, -1,  0, 0>;
+using velocity      = dimension<1, 0, -1,  0, 0>;
+using acceleration  = dimension<1, 0, -2,  0, 0>;
+using power         = dimension<2, 1, -3,  0, 0>;
+using voltage       = dimension<2, 1, -3, -1, 0>;
+using resistance    = dimension<2, 1, -3, -2, 0>;
+using charge        = dimension<0, 0,  1,  1, 0>;
+}  // namespace dimensions
+
+//-------------------------------------------------------------------------------------------------
+// Units
+//
+// A unit is a dimension and a scale: the ratio between the unit and the coherent SI unit of its dimension.
+// Units with the same dimension and scale are the same type, however they were built.
+//
+// Usage:
+//     using ticks = scaled_unit<units::seconds, ratio<1, 16000000>>;  // A 16 MHz timer
+//     static_assert(is_same_v<unit_multiply_t<units::milliamperes, units::ohms>, units::millivolts>(), "");
+//-------------------------------------------------------------------------------------------------
+
+template <typename Dimension, typename Scale = ratio<1>>
+struct unit {
+  static_assert(Scale::num > 0, "A unit's scale must be positive.");
+
+  using dimension_type = Dimension;
+  using scale = typename Scale::type;
+  using type = unit<Dimension, scale>;
+};
+
+/// Unit scaled by Ratio, e.g. scaled_unit<units::volts, milli> is units::millivolts
+template <typename Unit, typename Ratio>
+using scaled_unit = unit<typename Unit::dimension_type, ratio_multiply_t<typename Unit::scale, Ratio>>;
+
+template <typename U1, typename U2>
+using unit_multiply_t = unit<dimension_multiply_t<typename U1::dimension_type, typename U2::dimension_type>,
+                             ratio_multiply_t<typename U1::scale, typename U2::scale>>;
+
+template <typename U1, typename U2>
+using unit_divide_t = unit<dimension_divide_t<typename U1::dimension_type, typename U2::dimension_type>,
+                           ratio_divide_t<typename U1::scale, typename U2::scale>>;
+
+/// Whether quantities in U1 can be converted to U2
+template <typename U1, typename U2>
+inline constexpr bool same_dimension_v() { return is_same_v<typename U1::dimension_type, typename U2::dimension_type>(); }
+
+namespace units {
+using scalar       = unit<dimensions::dimensionless>;
+using meters       = unit<dimensions::length>;
+using millimeters  = unit<dimensions::length, milli>;
+using kilometers   = unit<dimensions::length, kilo>;
+using kilograms    = unit<dimensions::mass>;
+using grams        = unit<dimensions::mass, milli>;
+using seconds      = unit<dimensions::time>;
+using milliseconds = unit<dimensions::time, milli>;
+using microseconds = unit<dimensions::time, micro>;
+using nanoseconds  = unit<dimensions::time, nano>;
+using hertz        = unit<dimensions::frequency>;
+using kilohertz    = unit<dimensions::frequency, kilo>;
+using megahertz    = unit<dimensions::frequency, mega>;
+using amperes      = unit<dimensions::current>;
+using milliamperes = unit<dimensions::current, milli>;
+using microamperes = unit<dimensions::current, micro>;
+using volts        = unit<dimensions::voltage>;
+using millivolts   = unit<dimensions::voltage, milli>;
+using microvolts   = unit<dimensions::voltage, micro>;
+using ohms         = unit<dimensions::resistance>;
+using kiloohms     = unit<dimensions::resistance, kilo>;
+using watts        = unit<dimensions::power>;
+using milliwatts   = unit<dimensions::power, milli>;
+using kelvin       = unit<dimensions::temperature>;
+}  // namespace units
+
+//-------------------------------------------------------------------------------------------------
+// quantity
+//
+// A value of type Rep, counted in Unit. Rep is an integer of std_int.hpp, a floating-point type,
+//   or a fixed_point type. A quantity is exactly the size of its Rep, and units only exist at compile time.
+//
+// Addition, subtraction and comparison require the same dimension: adding seconds to meters doesn't compile.
+//   Mixed units of the same dimension and Rep convert both operands to the finer unit, e.g. volts + millivolts
+//   is millivolts. For integer and fixed-point Reps, one unit must then be a whole multiple of the other.
+// Multiplying and dividing quantities computes the resulting unit, e.g. milliamperes * ohms is millivolts.
+//
+// Conversions between units of the same dimension multiply by a single constant, folded at compile time:
+//   - Integers: one multiplication, or one division by a constant (which compilers emit as a multiply
+//     and shift, or a plain shift for powers of two), or both in the next wider integer type.
+//     Divisions truncate toward zero.
+//   - Floating-point: one multiplication by the ratio, rounded to Rep.
+//   - Fixed-point: the integer conversion of the raw representation.
+// The conversion is implicit when it can't lose precision: the factor is whole, or the target is
+//   floating-point, and the source Rep converts to the target Rep without narrowing. Otherwise, it's
+//   explicit through quantity_cast, e.g. from quantity<volts, int32_t> to quantity<millivolts, int16_t>.
+//
+// Usage:
+//     using adc_reading = quantity<units::millivolts, uint16_t>;
+//     using timer_ticks = quantity<scaled_unit<units::seconds, ratio<1, 16000000>>, uint32_t>;
+//
+//     adc_reading v(3300);
+//     timer_ticks t(1600);
+//     auto volts = quantity_cast<quantity<units::volts, float>>(v);          // v.count() * 0.001f
+//     auto us = quantity_cast<quantity<units::microseconds, uint32_t>>(t);  // t.count() / 16, a shift
+//     auto wrong = v + t;                                                 // Doesn't compile
+//-------------------------------------------------------------------------------------------------
+
+// Forward declaration of the implementation
+namespace detail {
+template <typename ToUnit, typename ToRep, typename FromUnit, typename FromRep>
+constexpr ToRep quantity_convert(FromRep value);
+template <typename U1, typename U2, typename Rep,
+          typename Factor = ratio_divide_t<typename U1::scale, typename U2::scale>>
+struct quantity_common;
+}  // namespace detail
+
+template <typename Unit, typename Rep>
+class quantity {
+ public:
+  using unit_type = typename Unit::type;
+  using rep = Rep;
+
+  /// Zero-initialized
+  constexpr quantity() : count_() {}
+
+  /// A quantity of count units
+  constexpr explicit quantity(Rep count) : count_(count) {}
+
+  /// Implicit conversion, from units of the same dimension, when the conversion is exact.
+  ///   Otherwise, this constructor doesn't participate in overload resolution.
+  template <typename U2, typename R2,
+            enable_if_t<same_dimension_v<U2, Unit>() && is_widening_v<R2, Rep>() &&
+                            (is_floating_point_v<Rep>() ||
+                             ratio_divide_t<typename U2::scale, typename Unit::scale>::den == 1),
+                        int> = 0>
+  constexpr quantity(const quantity<U2, R2>& other)
+      : count_(detail::quantity_convert<Unit, Rep, U2, R2>(other.count())) {}
+
+  /// Value, counted in Unit
+  constexpr Rep count() const { return count_; }
+
+  //-----------------------------------------------------------------------------------------------
+  // Arithmetic
+  //-----------------------------------------------------------------------------------------------
+
+  constexpr quantity operator+() const { return *this; }
+  constexpr quantity operator-() const { return quantity(-count_); }
+
+  friend constexpr quantity operator+(quantity a, quantity b) { return quantity(a.count_ + b.count_); }
+  friend constexpr quantity operator-(quantity a, quantity b) { return quantity(a.count_ - b.count_); }
+
+  /// Scaling, by dimensionless values
+  friend constexpr quantity operator*(quantity a, Rep b) { return quantity(a.count_ * b); }
+  friend constexpr quantity operator*(Rep a, quantity b) { return quantity(a * b.count_); }
+  friend constexpr quantity operator/(quantity a, Rep b) { return quantity(a.count_ / b); }
+
+  quantity& operator+=(quantity other) { return *this = *this + other; }
+  quantity& operator-=(quantity other) { return *this = *this - other; }
+  quantity& operator*=(Rep other) { return *this = *this * other; }
+  quantity& operator/=(Rep other) { return *this = *this / other; }
+
+  //-----------------------------------------------------------------------------------------------
+  // Comparison
+  //-----------------------------------------------------------------------------------------------
+
+  friend constexpr bool operator==(quantity a, quantity b) { return a.count_ == b.count_; }
+  friend constexpr bool operator!=(quantity a, quantity b) { return a.count_ != b.count_; }
+  friend constexpr bool operator<(quantity a, quantity b) { return a.count_ < b.count_; }
+  friend constexpr bool operator<=(quantity a, quantity b) { return a.count_ <= b.count_; }
+  friend constexpr bool operator>(quantity a, quantity b) { return a.count_ > b.count_; }
+  friend constexpr bool operator>=(quantity a, quantity b) { return a.count_ >= b.count_; }
+
+ private:
+  Rep count_;
+};
+
+/// Product of quantities, in the product of their units
+template <typename U1, typename U2, typename Rep>
+constexpr quantity<unit_multiply_t<U1, U2>, Rep> operator*(quantity<U1, Rep> a, quantity<U2, Rep> b) {
+  return quantity<unit_multiply_t<U1, U2>, Rep>(a.count() * b.count());
+}
+
+/// Quotient of quantities, in the quotient of their units
+template <typename U1, typename U2, typename Rep>
+constexpr quantity<unit_divide_t<U1, U2>, Rep> operator/(quantity<U1, Rep> a, quantity<U2, Rep> b) {
+  return quantity<unit_divide_t<U1, U2>, Rep>(a.count() / b.count());
+}
+
+/// Common type of quantities in different units of the same dimension, with the same Rep: the finer unit.
+///   Undefined when the units are the same, or when the conversion isn't implicit.
+template <typename U1, typename U2, typename Rep>
+using quantity_common_t = typename detail::quantity_common<U1, U2, Rep>::type;
+
+/// Mixed units, computed in the common type. Without these, the hidden friends of both operands could
+///   apply through the implicit conversions, e.g. with a floating-point Rep, which is ambiguous.
+template <typename U1, typename U2, typename Rep, typename C = quantity_common_t<U1, U2, Rep>>
+constexpr C operator+(quantity<U1, Rep> a, quantity<U2, Rep> b) { return C(a) + C(b); }
+template <typename U1, typename U2, typename Rep, typename C = quantity_common_t<U1, U2, Rep>>
+constexpr C operator-(quantity<U1, Rep> a, quantity<U2, Rep> b) { return C(a) - C(b); }
+
+template <typename U1, typename U2, typename Rep, typename C = quantity_common_t<U1, U2, Rep>>
+constexpr bool operator==(quantity<U1, Rep> a, quantity<U2, Rep> b) { return C(a) == C(b); }
+template <typename U1, typename U2, typename Rep, typename C = quantity_common_t<U1, U2, Rep>>
+constexpr bool operator!=(quantity<U1, Rep> a, quantity<U2, Rep> b) { return C(a) != C(b); }
+template <typename U1, typename U2, typename Rep, typename C = quantity_common_t<U1, U2, Rep>>
+constexpr bool operator<(quantity<U1, Rep> a, quantity<U2, Rep> b) { return C(a) < C(b); }
+template <typename U1, typename U2, typename Rep, typename C = quantity_common_t<U1, U2, Rep>>
+constexpr bool operator<=(quantity<U1, Rep> a, quantity<U2, Rep> b) { return C(a) <= C(b); }
+template <typename U1, typename U2, typename Rep, typename C = quantity_common_t<U1, U2, Rep>>
+constexpr bool operator>(quantity<U1, Rep> a, quantity<U2, Rep> b) { return C(a) > C(b); }
+template <typename U1, typename U2, typename Rep, typename C = quantity_common_t<U1, U2, Rep>>
+constexpr bool operator>=(quantity<U1, Rep> a, quantity<U2, Rep> b) { return C(a) >= C(b); }
+
+/// Conversion to another unit of the same dimension, and possibly another Rep
+template <typename ToQuantity, typename Unit, typename Rep>
+constexpr ToQuantity quantity_cast(quantity<Unit, Rep> value) {
+  return ToQuantity(detail::quantity_convert<typename ToQuantity::unit_type, typename ToQuantity::rep, Unit, Rep>(
+      value.count()));
+}
+
+//-------------------------------------------------------------------------------------------------
+// Conversion implementation
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+/// Whether an int64_t constant is representable in T
+template <typename T>
+constexpr bool quantity_fits(int64_t value) { return value >= 0 && static_cast<int64_t>(static_cast<T>(value)) == value; }
+
+/// Type for the products of conversions with both a numerator and a denominator
+template <typename T, bool = has_wider_v<T>()> struct quantity_wide : make_wider<T> {};
+template <typename T> struct quantity_wide<T, false> : make_type<T> {};
+
+/// Integers: the constants are used in Rep when they fit, so 8-bit and 16-bit targets avoid 64-bit arithmetic
+template <typename Factor, typename Rep, bool Floating = is_floating_point_v<Rep>()>
+struct quantity_converter {
+  constexpr static Rep multiply(Rep value) {
+    return quantity_fits<Rep>(Factor::num) ? static_cast<Rep>(value * static_cast<Rep>(Factor::num))
+                                            : static_cast<Rep>(value * Factor::num);
+  }
+
+  constexpr static Rep divide(Rep value) {
+    return quantity_fits<Rep>(Factor::den) ? static_cast<Rep>(value / static_cast<Rep>(Factor::den))
+                                            : static_cast<Rep>(value / Factor::den);
+  }
+
+  constexpr static Rep apply(Rep value) {
+    return Factor::den == 1 ? (Factor::num == 1 ? value : multiply(value))
+           : Factor::num == 1
+               ? divide(value)
+               : static_cast<Rep>(static_cast<typename quantity_wide<Rep>::type>(value) * Factor::num / Factor::den);
+  }
+};
+
+/// Floating-point: the ratio is computed at compile time, leaving one multiplication
+template <typename Factor, typename Rep>
+struct quantity_converter<Factor, Rep, true> {
+  constexpr static Rep apply(Rep value) {
+    return Factor::den == 1 && Factor::num == 1
+               ? value
+               : value * (static_cast<Rep>(Factor::num) / static_cast<Rep>(Factor::den));
+  }
+};
+
+/// Fixed-point: the integer conversion, applied to the representation
+template <typename Factor, bool S, size_t I, size_t F, typename R, typename O>
+struct quantity_converter<Factor, fixed_point<S, I, F, R, O>, false> {
+  using type = fixed_point<S, I, F, R, O>;
+  constexpr static type apply(type value) {
+    return type::from_raw(quantity_converter<Factor, typename type::rep>::apply(value.raw()));
+  }
+};
+
+/// The conversion is computed in the target Rep, or in the source Rep when the target is an integer and the
+///   source is as wide or isn't an integer: fractions of floating or fixed-point values aren't lost, and
+///   narrowing casts convert before truncating.
+template <typename ToUnit, typename ToRep, typename FromUnit, typename FromRep>
+constexpr ToRep quantity_convert(FromRep value) {
+  static_assert(same_dimension_v<ToUnit, FromUnit>(), "Quantities can only be converted between units of the same dimension.");
+  using factor = ratio_divide_t<typename FromUnit::scale, typename ToUnit::scale>;
+  using compute =
+      conditional_t<is_integral_v<ToRep>() && !(is_integral_v<FromRep>() && sizeof(ToRep) > sizeof(FromRep)), FromRep,
+                    ToRep>;
+  return static_cast<ToRep>(quantity_converter<factor, compute>::apply(static_cast<compute>(value)));
+}
+
+/// The finer of two units, U1 if Factor = U1 / U2 is below 1. Defined if both quantities convert implicitly
+///   to it: the factor between the units is whole, or Rep is floating-point.
+template <typename U1, typename U2, typename Rep, typename Factor>
+struct quantity_common
+    : enable_if<same_dimension_v<U1, U2>() && !is_same_v<typename U1::type, typename U2::type>() &&
+                    (is_floating_point_v<Rep>() || Factor::num == 1 || Factor::den == 1),
+                quantity<conditional_t<(Factor::num < Factor::den), typename U1::type, typename U2::type>, Rep>> {};
+
+}  // namespace detail
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+namespace quantity_helpers {
+using ms = jtc::quantity<jtc::units::milliseconds, jtc::int32_t>;
+using mm = jtc::quantity<jtc::units::millimeters, jtc::int32_t>;
+
+template <typename To>
+constexpr bool accept(To) { return true; }
+
+/// Whether From is implicitly convertible to To
+template <typename From, typename To>
+struct converts {
+  template <typename F, typename = decltype(accept<To>(F()))>
+  constexpr static bool test(int) { return true; }
+  template <typename F>
+  constexpr static bool test(...) { return false; }
+
+  constexpr static bool value = test<From>(0);
+};
+
+/// Overloads on the dimension: only one of them is viable for a given argument
+constexpr int dimension_of(ms) { return 1; }
+constexpr int dimension_of(mm) { return 2; }
+}  // namespace quantity_helpers
+
+struct quantity_tests {
+  using mv = jtc::quantity<jtc::units::millivolts, jtc::int32_t>;
+  using v = jtc::quantity<jtc::units::volts, jtc::int32_t>;
+  using ticks = jtc::quantity<jtc::scaled_unit<jtc::units::seconds, jtc::ratio<1, 16000000>>, jtc::uint32_t>;
+  using us = jtc::quantity<jtc::units::microseconds, jtc::uint32_t>;
+
+  // No runtime overhead in size
+  static_assert(sizeof(mv) == sizeof(jtc::int32_t), "JTC test failed!");
+
+  // Unit algebra
+  static_assert(jtc::is_same_v<jtc::scaled_unit<jtc::units::volts, jtc::milli>, jtc::units::millivolts>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::unit_multiply_t<jtc::units::milliamperes, jtc::units::ohms>, jtc::units::millivolts>(),
+                "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::unit_divide_t<jtc::units::meters, jtc::units::seconds>,
+                               jtc::unit<jtc::dimensions::velocity>>(),
+                "JTC test failed!");
+  static_assert(!jtc::same_dimension_v<jtc::units::volts, jtc::units::amperes>(), "JTC test failed!");
+
+  // Conversions
+  static_assert(mv(v(3)).count() == 3000, "JTC test failed!");
+  static_assert(jtc::quantity_cast<v>(mv(3300)).count() == 3, "JTC test failed!");
+  static_assert(jtc::quantity_cast<v>(mv(-3300)).count() == -3, "JTC test failed!");
+  static_assert(jtc::quantity_cast<us>(ticks(1600)).count() == 100, "JTC test failed!");
+  static_assert(jtc::quantity_cast<jtc::quantity<jtc::units::milliseconds, jtc::int32_t>>(
+                    jtc::quantity<jtc::scaled_unit<jtc::units::seconds, jtc::ratio<1, 3>>, jtc::int32_t>(10))
+                        .count() == 3333,
+                "JTC test failed!");
+  static_assert(jtc::quantity<jtc::units::volts, double>(mv(1500)).count() == 1.5, "JTC test failed!");
+  static_assert(jtc::quantity_cast<jtc::quantity<jtc::units::volts, jtc::fixed<16, 16>>>(
+                    jtc::quantity<jtc::units::millivolts, jtc::fixed<16, 16>>(jtc::fixed<16, 16>(1500)))
+                        .count() == jtc::fixed<16, 16>(1.5),
+                "JTC test failed!");
+  static_assert(jtc::quantity_cast<mv>(jtc::quantity<jtc::units::volts, float>(1.25f)).count() == 1250,
+                "JTC test failed!");
+
+  // Implicit conversions: same dimension, whole factor or floating-point target, and no narrowing of Rep
+  using s32 = jtc::quantity<jtc::units::seconds, jtc::int32_t>;
+  using m32 = jtc::quantity<jtc::units::meters, jtc::int32_t>;
+  static_assert(quantity_helpers::converts<s32, quantity_helpers::ms>::value, "JTC test failed!");
+  static_assert(!quantity_helpers::converts<s32, quantity_helpers::mm>::value, "JTC test failed!");
+  static_assert(!quantity_helpers::converts<quantity_helpers::ms, s32>::value, "JTC test failed!");
+  static_assert(quantity_helpers::dimension_of(s32(1)) == 1 && quantity_helpers::dimension_of(m32(1)) == 2,
+                "JTC test failed!");
+
+  static_assert(!quantity_helpers::converts<v, jtc::quantity<jtc::units::millivolts, jtc::int16_t>>::value,
+                "JTC test failed!");
+  static_assert(!quantity_helpers::converts<v, jtc::quantity<jtc::units::millivolts, jtc::uint32_t>>::value,
+                "JTC test failed!");
+  static_assert(!quantity_helpers::converts<ticks, jtc::quantity<jtc::units::nanoseconds, jtc::int32_t>>::value,
+                "JTC test failed!");
+  static_assert(quantity_helpers::converts<jtc::quantity<jtc::units::volts, jtc::int16_t>, mv>::value,
+                "JTC test failed!");
+  static_assert(quantity_helpers::converts<us, jtc::quantity<jtc::units::nanoseconds, jtc::int64_t>>::value,
+                "JTC test failed!");
+  static_assert(quantity_helpers::converts<mv, jtc::quantity<jtc::units::volts, double>>::value, "JTC test failed!");
+  static_assert(!quantity_helpers::converts<mv, jtc::quantity<jtc::units::volts, float>>::value, "JTC test failed!");
+  static_assert(!quantity_helpers::converts<jtc::quantity<jtc::units::volts, double>,
+                                            jtc::quantity<jtc::units::millivolts, float>>::value,
+                "JTC test failed!");
+  static_assert(jtc::quantity_cast<jtc::quantity<jtc::units::millivolts, jtc::int16_t>>(v(10)).count() == 10000,
+                "JTC test failed!");
+
+  // Widening conversions are computed in the wider Rep, even with values that overflow the source Rep
+  static_assert(mv(jtc::quantity<jtc::units::volts, jtc::int16_t>(100)).count() == 100000, "JTC test failed!");
+  static_assert(mv(jtc::quantity<jtc::units::volts, jtc::int16_t>(-32768)).count() == -32768000, "JTC test failed!");
+  static_assert(jtc::quantity_cast<jtc::quantity<jtc::units::milliseconds, jtc::uint32_t>>(
+                    jtc::quantity<jtc::units::seconds, jtc::uint16_t>(70))
+                        .count() == 70000,
+                "JTC test failed!");
+  static_assert(jtc::quantity<jtc::units::nanoseconds, jtc::int64_t>(s32(2000000000)).count() == 2000000000000000000,
+                "JTC test failed!");
+  static_assert(jtc::quantity<jtc::units::milliseconds, jtc::uint64_t>(
+                    jtc::quantity<jtc::units::seconds, jtc::uint32_t>(4000000000u))
+                        .count() == 4000000000000u,
+                "JTC test failed!");
+
+  // Arithmetic
+  static_assert((mv(100) + mv(20)).count() == 120 && (mv(100) * 3).count() == 300, "JTC test failed!");
+
+  // Mixed units are computed in the finer one, with integer or floating-point Reps
+  static_assert(jtc::is_same_v<decltype(v(2) + mv(5)), mv>() && (v(2) + mv(5)).count() == 2005, "JTC test failed!");
+  static_assert((mv(5) - v(2)).count() == -1995 && v(2) > mv(1999) && v(2) == mv(2000), "JTC test failed!");
+  using v_f64 = jtc::quantity<jtc::units::volts, double>;
+  using mv_f64 = jtc::quantity<jtc::units::millivolts, double>;
+  static_assert(jtc::is_same_v<decltype(v_f64(1.5) + mv_f64(20)), mv_f64>(), "JTC test failed!");
+  static_assert((v_f64(1.5) + mv_f64(20)).count() == 1520, "JTC test failed!");
+  static_assert((mv_f64(20) - v_f64(1.5)).count() == -1480, "JTC test failed!");
+  static_assert(v_f64(1.5) == mv_f64(1500) && mv_f64(1500) != v_f64(1) && mv_f64(20) < v_f64(1), "JTC test failed!");
+  static_assert(v_f64(1) <= mv_f64(1000) && v_f64(1) >= mv_f64(1000) && !(v_f64(1) > mv_f64(1000)), "JTC test failed!");
+  static_assert((jtc::quantity<jtc::units::milliamperes, jtc::int32_t>(20) *
+                 jtc::quantity<jtc::units::ohms, jtc::int32_t>(100)) == mv(2000),
+                "JTC test failed!");
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
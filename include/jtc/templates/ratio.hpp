@@ -0,0 +1,132 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// ratio.hpp: Emulates std::ratio, compile-time rational numbers
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_RATIO_HPP
+#define JTC_TEMPLATES_RATIO_HPP
+
+#include "integral_constant.hpp"
+#include "is_same.hpp"
+#include "std_int.hpp"
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// ratio
+//
+// A rational number Num / Den, reduced to lowest terms, with a positive denominator.
+// The reduced form is the member 'type', so equal ratios are the same type after any operation.
+//
+// Usage:
+//     using milli = ratio<1, 1000>;
+//     static_assert(ratio<2, 4>::num == 1 && ratio<2, 4>::den == 2, "Should be reduced");
+//     static_assert(is_same_v<ratio_multiply_t<kilo, milli>, ratio<1>>(), "Should be 1");
+//-------------------------------------------------------------------------------------------------
+
+// Helpers for the reduction to lowest terms
+namespace detail {
+constexpr int64_t ratio_abs(int64_t x) { return x < 0 ? -x : x; }
+constexpr int64_t ratio_gcd(int64_t a, int64_t b) { return b == 0 ? ratio_abs(a) : ratio_gcd(b, a % b); }
+constexpr int64_t ratio_sign(int64_t x) { return x < 0 ? -1 : 1; }
+}  // namespace detail
+
+template <int64_t Num, int64_t Den = 1>
+struct ratio {
+  static_assert(Den != 0, "ratio requires a non-zero denominator.");
+
+  /// Numerator and denominator, in lowest terms
+  constexpr static int64_t num = detail::ratio_sign(Den) * Num / detail::ratio_gcd(Num, Den);
+  constexpr static int64_t den = detail::ratio_abs(Den) / detail::ratio_gcd(Num, Den);
+
+  /// The reduced ratio
+  using type = ratio<num, den>;
+};
+
+template <int64_t Num, int64_t Den>
+constexpr int64_t ratio<Num, Den>::num;
+
+template <int64_t Num, int64_t Den>
+constexpr int64_t ratio<Num, Den>::den;
+
+//-------------------------------------------------------------------------------------------------
+// Arithmetic
+//
+// Operands are reduced crosswise before multiplying, so intermediate values overflow as late as possible.
+//-------------------------------------------------------------------------------------------------
+
+template <typename R1, typename R2>
+struct ratio_multiply
+    : ratio<(R1::num / detail::ratio_gcd(R1::num, R2::den)) * (R2::num / detail::ratio_gcd(R2::num, R1::den)),
+            (R1::den / detail::ratio_gcd(R2::num, R1::den)) * (R2::den / detail::ratio_gcd(R1::num, R2::den))> {};
+
+template <typename R1, typename R2>
+using ratio_multiply_t = typename ratio_multiply<R1, R2>::type;
+
+template <typename R1, typename R2>
+struct ratio_divide : ratio_multiply<R1, ratio<R2::den, R2::num>> {};
+
+template <typename R1, typename R2>
+using ratio_divide_t = typename ratio_divide<R1, R2>::type;
+
+//-------------------------------------------------------------------------------------------------
+// Comparison
+//-------------------------------------------------------------------------------------------------
+
+template <typename R1, typename R2>
+struct ratio_equal : bool_constant<R1::num == R2::num && R1::den == R2::den> {};
+
+template <typename R1, typename R2>
+inline constexpr bool ratio_equal_v() { return ratio_equal<R1, R2>::value; }
+
+//-------------------------------------------------------------------------------------------------
+// SI prefixes that fit in 64 bits
+//-------------------------------------------------------------------------------------------------
+
+using nano  = ratio<1, 1000000000>;
+using micro = ratio<1, 1000000>;
+using milli = ratio<1, 1000>;
+using centi = ratio<1, 100>;
+using deci  = ratio<1, 10>;
+using kilo  = ratio<1000>;
+using mega  = ratio<1000000>;
+using giga  = ratio<1000000000>;
+
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+struct ratio_tests {
+  // Reduction
+  static_assert(jtc::ratio<2, 4>::num == 1 && jtc::ratio<2, 4>::den == 2, "JTC test failed!");
+  static_assert(jtc::ratio<3, -6>::num == -1 && jtc::ratio<3, -6>::den == 2, "JTC test failed!");
+  static_assert(jtc::ratio<0, 5>::num == 0 && jtc::ratio<0, 5>::den == 1, "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::ratio<10, 20>::type, jtc::ratio<1, 2>>(), "JTC test failed!");
+
+  // Arithmetic
+  static_assert(jtc::is_same_v<jtc::ratio_multiply_t<jtc::kilo, jtc::milli>, jtc::ratio<1>>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::ratio_divide_t<jtc::milli, jtc::micro>, jtc::ratio<1000>>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::ratio_multiply_t<jtc::ratio<2, 3>, jtc::ratio<9, 4>>, jtc::ratio<3, 2>>(),
+                "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::ratio_multiply_t<jtc::giga, jtc::nano>, jtc::ratio<1>>(), "JTC test failed!");
+
+  // Comparison
+  static_assert(jtc::ratio_equal_v<jtc::ratio<1, 2>, jtc::ratio<50, 100>>(), "JTC test failed!");
+  static_assert(!jtc::ratio_equal_v<jtc::milli, jtc::micro>(), "JTC test failed!");
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
@@ -0,0 +1,398 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// saturating.hpp: Overflow-checked and saturating integer arithmetic
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_SATURATING_HPP
+#define JTC_TEMPLATES_SATURATING_HPP
+
+#include "conditional.hpp"
+#include "enable_if.hpp"
+#include "integer_width.hpp"
+#include "integral_constant.hpp"
+#include "is_same.hpp"
+#include "make_signed_unsigned.hpp"
+#include "number_traits.hpp"
+#include "std_def.hpp"
+#include "std_int.hpp"
+
+// Overflow builtins are used where available (GCC 5+ and Clang).
+// Otherwise, operations are computed in a wider type, or with portable checks for 64-bit types.
+// Define JTC_HAS_BUILTIN_OVERFLOW as 0 to force the portable implementation.
+#ifndef JTC_HAS_BUILTIN_OVERFLOW
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_add_overflow)
+#define JTC_HAS_BUILTIN_OVERFLOW 1
+#endif
+#elif defined(__GNUC__) && __GNUC__ >= 5
+#define JTC_HAS_BUILTIN_OVERFLOW 1
+#endif
+#endif
+
+#ifndef JTC_HAS_BUILTIN_OVERFLOW
+#define JTC_HAS_BUILTIN_OVERFLOW 0
+#endif
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// Integer limits
+//
+// Usage:
+//     static_assert(int_max<int8_t>() == 127, "...");
+//     static_assert(int_min<uint16_t>() == 0, "...");
+//-------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline constexpr T int_max() {
+  return is_signed_v<T>() ? static_cast<T>(static_cast<make_unsigned_t<T>>(~make_unsigned_t<T>(0)) >> 1)
+                          : static_cast<T>(~T(0));
+}
+
+template <typename T>
+inline constexpr T int_min() {
+  return is_signed_v<T>() ? static_cast<T>(-int_max<T>() - 1) : T(0);
+}
+
+//-------------------------------------------------------------------------------------------------
+// Overflow detection
+//
+// Computes a op b as if with infinite precision, stores the result wrapped to R and returns
+//   whether it overflowed, i.e. whether the stored value is different from the exact one.
+// Operands and result may have different types and signedness, as in GCC's __builtin_*_overflow.
+// Without the builtins, mixed 64-bit operations are not supported.
+//
+// Usage:
+//     int8_t result;
+//     bool overflow = add_overflow(uint8_t(200), int16_t(-100), result);  // false, result == 100
+//-------------------------------------------------------------------------------------------------
+
+// Forward declaration of the implementation
+namespace detail {
+struct add_op;
+struct sub_op;
+struct mul_op;
+template <typename Op, typename R, typename A, typename B> bool overflow_impl(A a, B b, R& result);
+}  // namespace detail
+
+template <typename R, typename A, typename B>
+inline bool add_overflow(A a, B b, R& result) { return detail::overflow_impl<detail::add_op>(a, b, result); }
+
+template <typename R, typename A, typename B>
+inline bool sub_overflow(A a, B b, R& result) { return detail::overflow_impl<detail::sub_op>(a, b, result); }
+
+template <typename R, typename A, typename B>
+inline bool mul_overflow(A a, B b, R& result) { return detail::overflow_impl<detail::mul_op>(a, b, result); }
+
+//-------------------------------------------------------------------------------------------------
+// Checked arithmetic
+//
+// Returns the wrapped result of the operation, and whether it overflowed.
+//
+// Usage:
+//     auto sum = checked_add<int16_t>(a, b);
+//     if (sum.overflow) { /* handle the error */ }
+//-------------------------------------------------------------------------------------------------
+
+template <typename T>
+struct checked_result {
+  /// Result of the operation, wrapped in case of overflow
+  T value;
+  /// Whether the operation overflowed
+  bool overflow;
+};
+
+template <typename T, enable_if_t<is_integral_v<T>(), int> = 0>
+inline checked_result<T> checked_add(T a, T b) {
+  checked_result<T> result;
+  result.overflow = add_overflow(a, b, result.value);
+  return result;
+}
+
+template <typename T, enable_if_t<is_integral_v<T>(), int> = 0>
+inline checked_result<T> checked_sub(T a, T b) {
+  checked_result<T> result;
+  result.overflow = sub_overflow(a, b, result.value);
+  return result;
+}
+
+template <typename T, enable_if_t<is_integral_v<T>(), int> = 0>
+inline checked_result<T> checked_mul(T a, T b) {
+  checked_result<T> result;
+  result.overflow = mul_overflow(a, b, result.value);
+  return result;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Saturating arithmetic
+//
+// Results out of range are clamped to int_min<T>() or int_max<T>().
+// Types narrower than 64 bits are computed in a wider type and clamped, with no branches.
+// 64-bit types select the saturated value from the overflow flag, which compiles to conditional moves.
+//
+// sat_op<R>(a, b) also accepts operands of other types and signedness, up to 32 bits, saturating the exact
+//   result to R. They're computed in a 64-bit intermediate. Wider operands are converted to R first.
+//
+// Usage:
+//     int16_t sample = sat_mul(int16_t(-300), int16_t(300));  // -32768
+//     uint8_t pixel = sat_add<uint8_t>(200, 100);              // 255
+//     uint8_t level = sat_sub<uint8_t>(uint8_t(10), 20);       // 0
+//-------------------------------------------------------------------------------------------------
+
+// Forward declaration of the implementation
+namespace detail {
+template <typename Op, typename T> T saturate_impl(T a, T b, true_type);
+template <typename Op, typename T> T saturate_impl(T a, T b, false_type);
+template <typename Op, typename R, typename A, typename B> R saturate_mixed(A a, B b);
+
+/// Whether sat_op<R>(a, b) selects the mixed overloads: operands up to 32 bits, with types different from R
+template <typename R, typename A, typename B>
+inline constexpr bool is_mixed_saturation() {
+  return (!is_same_v<A, B>() || !is_same_v<A, R>()) && sizeof(A) <= 4 && sizeof(B) <= 4;
+}
+}  // namespace detail
+
+template <typename T, enable_if_t<is_integral_v<T>(), int> = 0>
+inline T sat_add(T a, T b) { return detail::saturate_impl<detail::add_op>(a, b, bool_constant<has_wider_v<T>()>{}); }
+
+template <typename T, enable_if_t<is_integral_v<T>(), int> = 0>
+inline T sat_sub(T a, T b) { return detail::saturate_impl<detail::sub_op>(a, b, bool_constant<has_wider_v<T>()>{}); }
+
+template <typename T, enable_if_t<is_integral_v<T>(), int> = 0>
+inline T sat_mul(T a, T b) { return detail::saturate_impl<detail::mul_op>(a, b, bool_constant<has_wider_v<T>()>{}); }
+
+template <typename R, typename A, typename B, enable_if_t<detail::is_mixed_saturation<R, A, B>(), int> = 0>
+inline R sat_add(A a, B b) { return detail::saturate_mixed<detail::add_op, R>(a, b); }
+
+template <typename R, typename A, typename B, enable_if_t<detail::is_mixed_saturation<R, A, B>(), int> = 0>
+inline R sat_sub(A a, B b) { return detail::saturate_mixed<detail::sub_op, R>(a, b); }
+
+template <typename R, typename A, typename B, enable_if_t<detail::is_mixed_saturation<R, A, B>(), int> = 0>
+inline R sat_mul(A a, B b) { return detail::saturate_mixed<detail::mul_op, R>(a, b); }
+
+//-------------------------------------------------------------------------------------------------
+// Array operations
+//
+// Element-wise saturating operations: out[i] = sat_op(a[i], b[i]), for i in [0, count).
+// The loop bodies are branch-free, so compilers can vectorize them.
+//-------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void sat_add_n(const T* a, const T* b, T* out, size_t count) {
+  for (size_t i = 0; i < count; i++) out[i] = sat_add(a[i], b[i]);
+}
+
+template <typename T>
+inline void sat_sub_n(const T* a, const T* b, T* out, size_t count) {
+  for (size_t i = 0; i < count; i++) out[i] = sat_sub(a[i], b[i]);
+}
+
+template <typename T>
+inline void sat_mul_n(const T* a, const T* b, T* out, size_t count) {
+  for (size_t i = 0; i < count; i++) out[i] = sat_mul(a[i], b[i]);
+}
+
+//-------------------------------------------------------------------------------------------------
+// Implementation
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+/// Whether value is within the range of R, comparing mathematical values of any signedness
+template <typename R, typename W>
+inline constexpr bool in_range(W value, true_type /* W is signed */) {
+  return (is_signed_v<R>() ? value >= static_cast<W>(int_min<R>()) : value >= 0) &&
+         (value < 0 || static_cast<make_unsigned_t<W>>(value) <= static_cast<make_unsigned_t<R>>(int_max<R>()));
+}
+
+template <typename R, typename W>
+inline constexpr bool in_range(W value, false_type /* W is unsigned */) {
+  return value <= static_cast<make_unsigned_t<R>>(int_max<R>());
+}
+
+/// Operations, with their intermediate types:
+///   - intermediate<A, B>: holds every exact result for operands up to 32 bits, in the portable implementation.
+///   - wide<T>: holds every exact result for operands of type T, for saturation.
+struct add_op {
+  template <typename A, typename B>
+  using intermediate = conditional_t<is_unsigned_v<A>() && is_unsigned_v<B>(), uint64_t, int64_t>;
+  template <typename T>
+  using wide = make_wider_t<T>;
+
+  template <typename W> constexpr static W apply(W a, W b) { return a + b; }
+
+#if JTC_HAS_BUILTIN_OVERFLOW
+  template <typename R, typename A, typename B>
+  static bool builtin(A a, B b, R& result) { return __builtin_add_overflow(a, b, &result); }
+#endif
+
+  /// Portable check for a single 64-bit type, computed with unsigned (wrapping) arithmetic
+  template <typename T>
+  static bool same_type(T a, T b, T& result) {
+    using U = make_unsigned_t<T>;
+    const U ua = static_cast<U>(a), ub = static_cast<U>(b), ur = static_cast<U>(ua + ub);
+    result = static_cast<T>(ur);
+    return is_signed_v<T>() ? (((ua ^ ur) & (ub ^ ur)) >> (sizeof(T) * 8 - 1)) != 0 : ur < ua;
+  }
+};
+
+struct sub_op {
+  template <typename A, typename B>
+  using intermediate = int64_t;
+  template <typename T>
+  using wide = make_signed_t<make_wider_t<T>>;
+
+  template <typename W> constexpr static W apply(W a, W b) { return a - b; }
+
+#if JTC_HAS_BUILTIN_OVERFLOW
+  template <typename R, typename A, typename B>
+  static bool builtin(A a, B b, R& result) { return __builtin_sub_overflow(a, b, &result); }
+#endif
+
+  template <typename T>
+  static bool same_type(T a, T b, T& result) {
+    using U = make_unsigned_t<T>;
+    const U ua = static_cast<U>(a), ub = static_cast<U>(b), ur = static_cast<U>(ua - ub);
+    result = static_cast<T>(ur);
+    return is_signed_v<T>() ? (((ua ^ ub) & (ua ^ ur)) >> (sizeof(T) * 8 - 1)) != 0 : ua < ub;
+  }
+};
+
+struct mul_op {
+  template <typename A, typename B>
+  using intermediate = conditional_t<is_unsigned_v<A>() && is_unsigned_v<B>(), uint64_t, int64_t>;
+  template <typename T>
+  using wide = make_wider_t<T>;
+
+  template <typename W> constexpr static W apply(W a, W b) { return a * b; }
+
+#if JTC_HAS_BUILTIN_OVERFLOW
+  template <typename R, typename A, typename B>
+  static bool builtin(A a, B b, R& result) { return __builtin_mul_overflow(a, b, &result); }
+#endif
+
+  template <typename T>
+  static bool same_type(T a, T b, T& result) {
+    using U = make_unsigned_t<T>;
+    result = static_cast<T>(static_cast<U>(static_cast<U>(a) * static_cast<U>(b)));
+    return is_signed_v<T>()
+               ? (a == T(-1) && b == int_min<T>()) || (b == T(-1) && a == int_min<T>()) ||
+                     (b != 0 && b != T(-1) && result / b != a)
+               : (a != 0 && result / a != b);
+  }
+};
+
+/// Portable implementation: operands up to 32 bits, computed in a 64-bit intermediate
+template <typename Op, typename R, typename A, typename B>
+inline bool overflow_portable(A a, B b, R& result, true_type) {
+  using W = typename Op::template intermediate<A, B>;
+  const W exact = Op::apply(static_cast<W>(a), static_cast<W>(b));
+  result = static_cast<R>(exact);
+  return !in_range<R>(exact, bool_constant<is_signed_v<W>()>{});
+}
+
+/// Portable implementation: 64-bit operands, which must all have the same type
+template <typename Op, typename R, typename A, typename B>
+inline bool overflow_portable(A a, B b, R& result, false_type) {
+  static_assert(is_same_v<A, B>() && is_same_v<A, R>(),
+                "Without overflow builtins, 64-bit operations require operands and result of the same type.");
+  return Op::same_type(a, b, result);
+}
+
+template <typename Op, typename R, typename A, typename B>
+inline bool overflow_impl(A a, B b, R& result) {
+  static_assert(is_integral_v<A>() && is_integral_v<B>() && is_integral_v<R>(), "Operands must be integers.");
+  static_assert(!is_same_v<R, bool>(), "The result can't be a bool.");
+#if JTC_HAS_BUILTIN_OVERFLOW
+  return Op::builtin(a, b, result);
+#else
+  return overflow_portable<Op>(a, b, result, bool_constant<(sizeof(A) <= 4 && sizeof(B) <= 4)>{});
+#endif
+}
+
+/// Whether value is below the minimum of T. Unsigned intermediates never are.
+template <typename T, typename W>
+inline constexpr bool below_min(W value, true_type) { return value < static_cast<W>(int_min<T>()); }
+
+template <typename T, typename W>
+inline constexpr bool below_min(W, false_type) { return false; }
+
+/// Value an overflowing operation saturates to
+template <typename T>
+inline constexpr T saturation_value(add_op, T a, T) { return is_signed_v<T>() && a < 0 ? int_min<T>() : int_max<T>(); }
+
+template <typename T>
+inline constexpr T saturation_value(sub_op, T a, T) {
+  return is_signed_v<T>() ? (a < 0 ? int_min<T>() : int_max<T>()) : int_min<T>();
+}
+
+template <typename T>
+inline constexpr T saturation_value(mul_op, T a, T b) {
+  return is_signed_v<T>() && ((a < 0) != (b < 0)) ? int_min<T>() : int_max<T>();
+}
+
+/// Saturation with a wider type: clamp the exact result
+template <typename Op, typename T>
+inline T saturate_impl(T a, T b, true_type) {
+  using W = typename Op::template wide<T>;
+  const W exact = Op::apply(static_cast<W>(a), static_cast<W>(b));
+  const W upper = exact > static_cast<W>(int_max<T>()) ? static_cast<W>(int_max<T>()) : exact;
+  return static_cast<T>(below_min<T>(upper, bool_constant<is_signed_v<W>()>{}) ? static_cast<W>(int_min<T>()) : upper);
+}
+
+/// Saturation without a wider type: select from the overflow flag
+template <typename Op, typename T>
+inline T saturate_impl(T a, T b, false_type) {
+  T result;
+  const bool overflow = overflow_impl<Op>(a, b, result);
+  return overflow ? saturation_value(Op{}, a, b) : result;
+}
+
+/// Mixed types: clamp the exact result, computed in the 64-bit intermediate, to R
+template <typename W>
+inline constexpr bool is_negative(W value, true_type /* W is signed */) { return value < 0; }
+
+template <typename W>
+inline constexpr bool is_negative(W, false_type /* W is unsigned */) { return false; }
+
+template <typename Op, typename R, typename A, typename B>
+inline R saturate_mixed(A a, B b) {
+  static_assert(is_integral_v<A>() && is_integral_v<B>() && is_integral_v<R>(), "Operands must be integers.");
+  static_assert(!is_same_v<R, bool>(), "The result can't be a bool.");
+  using W = typename Op::template intermediate<A, B>;
+  using is_signed_w = bool_constant<is_signed_v<W>()>;
+  const W exact = Op::apply(static_cast<W>(a), static_cast<W>(b));
+  return in_range<R>(exact, is_signed_w{})    ? static_cast<R>(exact)
+         : is_negative(exact, is_signed_w{}) ? int_min<R>()
+                                             : int_max<R>();
+}
+
+}  // namespace detail
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+struct integer_limits_tests {
+  static_assert(jtc::int_max<jtc::int8_t>() == 127, "JTC test failed!");
+  static_assert(jtc::int_min<jtc::int8_t>() == -128, "JTC test failed!");
+  static_assert(jtc::int_max<jtc::uint16_t>() == 65535, "JTC test failed!");
+  static_assert(jtc::int_min<jtc::uint16_t>() == 0, "JTC test failed!");
+  static_assert(jtc::int_max<jtc::int64_t>() == 0x7FFFFFFFFFFFFFFF, "JTC test failed!");
+  static_assert(jtc::int_max<jtc::uint64_t>() == 0xFFFFFFFFFFFFFFFF, "JTC test failed!");
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
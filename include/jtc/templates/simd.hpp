@@ -0,0 +1,538 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// simd.hpp: Portable fixed-size SIMD vectors, using compiler vector extensions or unrolled scalar code
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_SIMD_HPP
+#define JTC_TEMPLATES_SIMD_HPP
+
+#include "conditional.hpp"
+#include "cv_ref_traits.hpp"
+#include "declval.hpp"
+#include "integer_sequence.hpp"
+#include "integral_constant.hpp"
+#include "is_same.hpp"
+#include "make_type.hpp"
+#include "number_traits.hpp"
+#include "std_def.hpp"
+
+// GCC and Clang vector extensions are used where available.
+// Define JTC_HAS_VECTOR_EXTENSIONS as 0 to force the scalar implementation.
+#ifndef JTC_HAS_VECTOR_EXTENSIONS
+#if defined(__GNUC__) || defined(__clang__)
+#define JTC_HAS_VECTOR_EXTENSIONS 1
+#else
+#define JTC_HAS_VECTOR_EXTENSIONS 0
+#endif
+#endif
+
+// Size, in bytes, of the widest vector the target passes in registers: wider simd types are arrays of such vectors.
+#ifndef JTC_SIMD_REGISTER_SIZE
+#if defined(__AVX512F__)
+#define JTC_SIMD_REGISTER_SIZE 64
+#elif defined(__AVX__)
+#define JTC_SIMD_REGISTER_SIZE 32
+#else
+#define JTC_SIMD_REGISTER_SIZE 16
+#endif
+#endif
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// simd and simd_mask declarations
+//
+// simd<T, N> holds N values of the arithmetic type T, with element-wise operations.
+//   - With vector extensions, when N and sizeof(T) are powers of two, each operation maps to the
+//     target's SIMD instructions (e.g. SSE2/AVX2 on x86-64, NEON on ARM). Values wider than
+//     JTC_SIMD_REGISTER_SIZE are held as arrays of register-sized vectors.
+//   - Otherwise, each operation is a fully unrolled sequence of scalar operations.
+//
+// Comparisons return a simd_mask<T, N>, which can be reduced (any_of, all_of, none_of) or used in select().
+//
+// Usage:
+//     alignas(simd<float, 8>::alignment) float data[8] = {...};
+//     auto v = simd<float, 8>::load_aligned(data);
+//     auto clamped = select(v < 0.0f, simd<float, 8>(0.0f), v);  // max(v, 0)
+//     float total = reduce_add(clamped * 2.0f);
+//-------------------------------------------------------------------------------------------------
+
+// Forward declaration of the implementation
+namespace detail { template <typename T, size_t N> struct simd_impl_selector; }
+
+// Vectors wider than the target's registers are passed in memory, which GCC reports as an ABI change.
+// simd splits them, but JTC_SIMD_REGISTER_SIZE may overestimate the registers of some targets.
+//   Every function taking or returning vectors, from the operators below to the implementations, is inline,
+//   so there's no ABI to preserve.
+#if JTC_HAS_VECTOR_EXTENSIONS && defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+//-------------------------------------------------------------------------------------------------
+// Element-wise operators, valid for scalars and for vector extension types alike
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+namespace simd_ops {
+
+struct plus       { template <typename U> U operator()(const U& a, const U& b) const { return a + b; } };
+struct minus      { template <typename U> U operator()(const U& a, const U& b) const { return a - b; } };
+struct multiplies { template <typename U> U operator()(const U& a, const U& b) const { return a * b; } };
+struct divides    { template <typename U> U operator()(const U& a, const U& b) const { return a / b; } };
+struct bit_and    { template <typename U> U operator()(const U& a, const U& b) const { return a & b; } };
+struct bit_or     { template <typename U> U operator()(const U& a, const U& b) const { return a | b; } };
+struct bit_xor    { template <typename U> U operator()(const U& a, const U& b) const { return a ^ b; } };
+struct negate     { template <typename U> U operator()(const U& a) const { return -a; } };
+struct bit_not    { template <typename U> U operator()(const U& a) const { return ~a; } };
+struct minimum    { template <typename U> U operator()(const U& a, const U& b) const { return b < a ? b : a; } };
+struct maximum    { template <typename U> U operator()(const U& a, const U& b) const { return a < b ? b : a; } };
+
+struct equal      { template <typename U> auto operator()(const U& a, const U& b) const -> decltype(a == b) { return a == b; } };
+struct not_equal  { template <typename U> auto operator()(const U& a, const U& b) const -> decltype(a != b) { return a != b; } };
+struct less       { template <typename U> auto operator()(const U& a, const U& b) const -> decltype(a < b) { return a < b; } };
+struct less_equal { template <typename U> auto operator()(const U& a, const U& b) const -> decltype(a <= b) { return a <= b; } };
+
+}  // namespace simd_ops
+}  // namespace detail
+
+template <typename T, size_t N>
+class simd;
+
+template <typename T, size_t N>
+class simd_mask {
+  using impl = typename detail::simd_impl_selector<T, N>::type;
+  using data_type = typename impl::mask_type;
+
+ public:
+  /// Number of elements
+  constexpr static size_t size() { return N; }
+
+  /// Whether the i-th element is set
+  bool operator[](size_t i) const { return impl::mask_get(data_, i); }
+
+  friend simd_mask operator&&(const simd_mask& a, const simd_mask& b) { return simd_mask(impl::mask_and(a.data_, b.data_)); }
+  friend simd_mask operator||(const simd_mask& a, const simd_mask& b) { return simd_mask(impl::mask_or(a.data_, b.data_)); }
+  friend simd_mask operator!(const simd_mask& a) { return simd_mask(impl::mask_not(a.data_)); }
+
+  /// Reductions
+  friend bool any_of(const simd_mask& m) { return impl::mask_count(m.data_) != 0; }
+  friend bool all_of(const simd_mask& m) { return impl::mask_count(m.data_) == N; }
+  friend bool none_of(const simd_mask& m) { return impl::mask_count(m.data_) == 0; }
+  friend size_t popcount(const simd_mask& m) { return impl::mask_count(m.data_); }
+
+ private:
+  explicit simd_mask(const data_type& data) : data_(data) {}
+
+  data_type data_;
+
+  friend class simd<T, N>;
+};
+
+template <typename T, size_t N>
+class simd {
+  static_assert(is_arithmetic_v<T>() && !is_same_v<remove_cv_t<T>, bool>(), "simd requires an arithmetic element type.");
+  static_assert(!is_const_v<T>() && !is_volatile_v<T>(), "simd elements can't be cv-qualified.");
+  static_assert(N > 0, "simd requires at least one element.");
+
+  using impl = typename detail::simd_impl_selector<T, N>::type;
+  using data_type = typename impl::type;
+
+ public:
+  /// Element type
+  using value_type = T;
+  /// Result type of comparisons
+  using mask_type = simd_mask<T, N>;
+  /// Alignment required by load_aligned and store_aligned
+  constexpr static size_t alignment = impl::alignment;
+  /// Whether the compiler's vector extensions are used
+  constexpr static bool is_native = impl::is_native;
+
+  /// Number of elements
+  constexpr static size_t size() { return N; }
+
+  /// Uninitialized, like the built-in types
+  simd() = default;
+
+  /// Broadcast: all elements are initialized with value
+  simd(T value) : data_(impl::broadcast(value)) {}
+
+  /// Loads N elements from memory with any alignment
+  static simd load(const T* source) { return simd(impl::load(source)); }
+
+  /// Loads N elements from memory aligned to 'alignment'
+  static simd load_aligned(const T* source) { return simd(impl::load_aligned(source)); }
+
+  /// Stores N elements to memory with any alignment
+  void store(T* destination) const { impl::store(data_, destination); }
+
+  /// Stores N elements to memory aligned to 'alignment'
+  void store_aligned(T* destination) const { impl::store_aligned(data_, destination); }
+
+  /// Element access
+  T operator[](size_t i) const { return impl::get(data_, i); }
+  void set(size_t i, T value) { impl::set(data_, i, value); }
+
+  //-----------------------------------------------------------------------------------------------
+  // Element-wise arithmetic
+  //-----------------------------------------------------------------------------------------------
+
+  friend simd operator+(const simd& a, const simd& b) { return simd(impl::apply(a.data_, b.data_, detail::simd_ops::plus{})); }
+  friend simd operator-(const simd& a, const simd& b) { return simd(impl::apply(a.data_, b.data_, detail::simd_ops::minus{})); }
+  friend simd operator*(const simd& a, const simd& b) { return simd(impl::apply(a.data_, b.data_, detail::simd_ops::multiplies{})); }
+  friend simd operator/(const simd& a, const simd& b) { return simd(impl::apply(a.data_, b.data_, detail::simd_ops::divides{})); }
+  friend simd operator-(const simd& a) { return simd(impl::apply(a.data_, detail::simd_ops::negate{})); }
+  simd operator+() const { return *this; }
+
+  simd& operator+=(const simd& other) { return *this = *this + other; }
+  simd& operator-=(const simd& other) { return *this = *this - other; }
+  simd& operator*=(const simd& other) { return *this = *this * other; }
+  simd& operator/=(const simd& other) { return *this = *this / other; }
+
+  // Bitwise operations, for integral types only
+  friend simd operator&(const simd& a, const simd& b) { return simd(impl::apply(a.data_, b.data_, detail::simd_ops::bit_and{})); }
+  friend simd operator|(const simd& a, const simd& b) { return simd(impl::apply(a.data_, b.data_, detail::simd_ops::bit_or{})); }
+  friend simd operator^(const simd& a, const simd& b) { return simd(impl::apply(a.data_, b.data_, detail::simd_ops::bit_xor{})); }
+  friend simd operator~(const simd& a) { return simd(impl::apply(a.data_, detail::simd_ops::bit_not{})); }
+
+  //-----------------------------------------------------------------------------------------------
+  // Comparison
+  //-----------------------------------------------------------------------------------------------
+
+  friend mask_type operator==(const simd& a, const simd& b) { return make_mask(impl::compare(a.data_, b.data_, detail::simd_ops::equal{})); }
+  friend mask_type operator!=(const simd& a, const simd& b) { return make_mask(impl::compare(a.data_, b.data_, detail::simd_ops::not_equal{})); }
+  friend mask_type operator<(const simd& a, const simd& b) { return make_mask(impl::compare(a.data_, b.data_, detail::simd_ops::less{})); }
+  friend mask_type operator<=(const simd& a, const simd& b) { return make_mask(impl::compare(a.data_, b.data_, detail::simd_ops::less_equal{})); }
+  friend mask_type operator>(const simd& a, const simd& b) { return make_mask(impl::compare(b.data_, a.data_, detail::simd_ops::less{})); }
+  friend mask_type operator>=(const simd& a, const simd& b) { return make_mask(impl::compare(b.data_, a.data_, detail::simd_ops::less_equal{})); }
+
+  //-----------------------------------------------------------------------------------------------
+  // Selection and reductions
+  //-----------------------------------------------------------------------------------------------
+
+  /// Element-wise mask ? if_true : if_false
+  friend simd select(const mask_type& mask, const simd& if_true, const simd& if_false) {
+    return simd(impl::select(mask_data(mask), if_true.data_, if_false.data_));
+  }
+
+  friend simd min(const simd& a, const simd& b) { return select(b < a, b, a); }
+  friend simd max(const simd& a, const simd& b) { return select(a < b, b, a); }
+
+  /// Horizontal reductions, computed as a balanced tree
+  friend T reduce_add(const simd& v) { return reduce(v, detail::simd_ops::plus{}); }
+  friend T reduce_mul(const simd& v) { return reduce(v, detail::simd_ops::multiplies{}); }
+  friend T reduce_min(const simd& v) { return reduce(v, detail::simd_ops::minimum{}); }
+  friend T reduce_max(const simd& v) { return reduce(v, detail::simd_ops::maximum{}); }
+
+ private:
+  explicit simd(const data_type& data) : data_(data) {}
+
+  // Access to the mask's representation, for the friend functions
+  static mask_type make_mask(const typename impl::mask_type& data) { return mask_type(data); }
+  static const typename impl::mask_type& mask_data(const mask_type& mask) { return mask.data_; }
+
+  template <typename Op>
+  static T reduce(const simd& v, Op op) { return detail_reduce(v, op, integral_constant<size_t, 0>{}, integral_constant<size_t, N>{}); }
+
+  /// Reduction of the Count elements starting at Begin
+  template <typename Op, size_t Begin, size_t Count>
+  static T detail_reduce(const simd& v, Op op, integral_constant<size_t, Begin>, integral_constant<size_t, Count>) {
+    return op(detail_reduce(v, op, integral_constant<size_t, Begin>{}, integral_constant<size_t, Count / 2>{}),
+              detail_reduce(v, op, integral_constant<size_t, Begin + Count / 2>{}, integral_constant<size_t, Count - Count / 2>{}));
+  }
+
+  template <typename Op, size_t Begin>
+  static T detail_reduce(const simd& v, Op, integral_constant<size_t, Begin>, integral_constant<size_t, 1>) {
+    return v[Begin];
+  }
+
+  data_type data_;
+};
+
+//-------------------------------------------------------------------------------------------------
+// Implementations
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+/// Scalar implementation: arrays, with every operation unrolled through an index sequence
+template <typename T, size_t N>
+struct simd_array_impl {
+  struct type { T values[N]; };
+  struct mask_type { bool values[N]; };
+
+  constexpr static size_t alignment = alignof(type);
+  constexpr static bool is_native = false;
+
+  static T get(const type& v, size_t i) { return v.values[i]; }
+  static void set(type& v, size_t i, T value) { v.values[i] = value; }
+
+  template <size_t... Is>
+  static type broadcast(T value, index_sequence<Is...>) { return type{{((void)Is, value)...}}; }
+  static type broadcast(T value) { return broadcast(value, make_index_sequence<N>{}); }
+
+  template <size_t... Is>
+  static type load(const T* source, index_sequence<Is...>) { return type{{source[Is]...}}; }
+  static type load(const T* source) { return load(source, make_index_sequence<N>{}); }
+  static type load_aligned(const T* source) { return load(source); }
+
+  static void store(const type& v, T* destination) {
+    for (size_t i = 0; i < N; i++) destination[i] = v.values[i];
+  }
+  static void store_aligned(const type& v, T* destination) { store(v, destination); }
+
+  template <typename Op, size_t... Is>
+  static type apply(const type& a, const type& b, Op op, index_sequence<Is...>) {
+    return type{{static_cast<T>(op(a.values[Is], b.values[Is]))...}};
+  }
+  template <typename Op>
+  static type apply(const type& a, const type& b, Op op) { return apply(a, b, op, make_index_sequence<N>{}); }
+
+  template <typename Op, size_t... Is>
+  static type apply(const type& a, Op op, index_sequence<Is...>) { return type{{static_cast<T>(op(a.values[Is]))...}}; }
+  template <typename Op>
+  static type apply(const type& a, Op op) { return apply(a, op, make_index_sequence<N>{}); }
+
+  template <typename Op, size_t... Is>
+  static mask_type compare(const type& a, const type& b, Op op, index_sequence<Is...>) {
+    return mask_type{{op(a.values[Is], b.values[Is])...}};
+  }
+  template <typename Op>
+  static mask_type compare(const type& a, const type& b, Op op) { return compare(a, b, op, make_index_sequence<N>{}); }
+
+  template <size_t... Is>
+  static type select(const mask_type& m, const type& a, const type& b, index_sequence<Is...>) {
+    return type{{(m.values[Is] ? a.values[Is] : b.values[Is])...}};
+  }
+  static type select(const mask_type& m, const type& a, const type& b) { return select(m, a, b, make_index_sequence<N>{}); }
+
+  static bool mask_get(const mask_type& m, size_t i) { return m.values[i]; }
+
+  template <size_t... Is>
+  static mask_type mask_and(const mask_type& a, const mask_type& b, index_sequence<Is...>) { return mask_type{{(a.values[Is] && b.values[Is])...}}; }
+  static mask_type mask_and(const mask_type& a, const mask_type& b) { return mask_and(a, b, make_index_sequence<N>{}); }
+
+  template <size_t... Is>
+  static mask_type mask_or(const mask_type& a, const mask_type& b, index_sequence<Is...>) { return mask_type{{(a.values[Is] || b.values[Is])...}}; }
+  static mask_type mask_or(const mask_type& a, const mask_type& b) { return mask_or(a, b, make_index_sequence<N>{}); }
+
+  template <size_t... Is>
+  static mask_type mask_not(const mask_type& a, index_sequence<Is...>) { return mask_type{{!a.values[Is]...}}; }
+  static mask_type mask_not(const mask_type& a) { return mask_not(a, make_index_sequence<N>{}); }
+
+  static size_t mask_count(const mask_type& m) {
+    size_t count = 0;
+    for (size_t i = 0; i < N; i++) count += m.values[i] ? 1 : 0;
+    return count;
+  }
+};
+
+#if JTC_HAS_VECTOR_EXTENSIONS
+
+/// Native implementation: GCC/Clang vector extension types, where operators apply to all elements
+template <typename T, size_t N>
+struct simd_vector_impl {
+  typedef T type __attribute__((vector_size(sizeof(T) * N)));
+  /// Comparisons result in a vector of signed integers of the same size: all ones (true) or zero (false)
+  using mask_type = decltype(declval<type>() < declval<type>());
+
+  constexpr static size_t alignment = alignof(type);
+  constexpr static bool is_native = true;
+
+  static T get(const type& v, size_t i) { return v[i]; }
+  static void set(type& v, size_t i, T value) { v[i] = value; }
+
+  template <size_t... Is>
+  static type broadcast(T value, index_sequence<Is...>) { return type{((void)Is, value)...}; }
+  static type broadcast(T value) { return broadcast(value, make_index_sequence<N>{}); }
+
+  // memcpy avoids aliasing issues, and compiles to a single vector load or store
+  static type load(const T* source) {
+    type v;
+    __builtin_memcpy(&v, source, sizeof(type));
+    return v;
+  }
+  static type load_aligned(const T* source) {
+    type v;
+    __builtin_memcpy(&v, __builtin_assume_aligned(source, alignment), sizeof(type));
+    return v;
+  }
+
+  static void store(const type& v, T* destination) { __builtin_memcpy(destination, &v, sizeof(type)); }
+  static void store_aligned(const type& v, T* destination) {
+    __builtin_memcpy(__builtin_assume_aligned(destination, alignment), &v, sizeof(type));
+  }
+
+  template <typename Op>
+  static type apply(const type& a, const type& b, Op op) { return op(a, b); }
+  template <typename Op>
+  static type apply(const type& a, Op op) { return op(a); }
+
+  template <typename Op>
+  static mask_type compare(const type& a, const type& b, Op op) { return op(a, b); }
+
+  /// Bitwise selection, valid for floating-point elements through a reinterpretation to the mask type
+  static type select(const mask_type& m, const type& a, const type& b) {
+    return (type)(((mask_type)a & m) | ((mask_type)b & ~m));
+  }
+
+  static bool mask_get(const mask_type& m, size_t i) { return m[i] != 0; }
+  static mask_type mask_and(const mask_type& a, const mask_type& b) { return a & b; }
+  static mask_type mask_or(const mask_type& a, const mask_type& b) { return a | b; }
+  static mask_type mask_not(const mask_type& a) { return ~a; }
+
+  static size_t mask_count(const mask_type& m) {
+    size_t count = 0;
+    for (size_t i = 0; i < N; i++) count += m[i] != 0 ? 1 : 0;
+    return count;
+  }
+};
+
+/// Native implementation for vectors wider than a register: an array of register-sized vectors, each of W elements
+template <typename T, size_t N, size_t W>
+struct simd_split_impl {
+  using part = simd_vector_impl<T, W>;
+  constexpr static size_t parts = N / W;
+
+  struct type { typename part::type values[parts]; };
+  struct mask_type { typename part::mask_type values[parts]; };
+
+  constexpr static size_t alignment = part::alignment;
+  constexpr static bool is_native = true;
+
+  static T get(const type& v, size_t i) { return part::get(v.values[i / W], i % W); }
+  static void set(type& v, size_t i, T value) { part::set(v.values[i / W], i % W, value); }
+
+  template <size_t... Is>
+  static type broadcast(T value, index_sequence<Is...>) { return type{{((void)Is, part::broadcast(value))...}}; }
+  static type broadcast(T value) { return broadcast(value, make_index_sequence<parts>{}); }
+
+  // The parts are contiguous, so the whole array is copied at once
+  static type load(const T* source) {
+    type v;
+    __builtin_memcpy(&v, source, sizeof(type));
+    return v;
+  }
+  static type load_aligned(const T* source) {
+    type v;
+    __builtin_memcpy(&v, __builtin_assume_aligned(source, alignment), sizeof(type));
+    return v;
+  }
+
+  static void store(const type& v, T* destination) { __builtin_memcpy(destination, &v, sizeof(type)); }
+  static void store_aligned(const type& v, T* destination) {
+    __builtin_memcpy(__builtin_assume_aligned(destination, alignment), &v, sizeof(type));
+  }
+
+  template <typename Op, size_t... Is>
+  static type apply(const type& a, const type& b, Op op, index_sequence<Is...>) {
+    return type{{part::apply(a.values[Is], b.values[Is], op)...}};
+  }
+  template <typename Op>
+  static type apply(const type& a, const type& b, Op op) { return apply(a, b, op, make_index_sequence<parts>{}); }
+
+  template <typename Op, size_t... Is>
+  static type apply(const type& a, Op op, index_sequence<Is...>) { return type{{part::apply(a.values[Is], op)...}}; }
+  template <typename Op>
+  static type apply(const type& a, Op op) { return apply(a, op, make_index_sequence<parts>{}); }
+
+  template <typename Op, size_t... Is>
+  static mask_type compare(const type& a, const type& b, Op op, index_sequence<Is...>) {
+    return mask_type{{part::compare(a.values[Is], b.values[Is], op)...}};
+  }
+  template <typename Op>
+  static mask_type compare(const type& a, const type& b, Op op) { return compare(a, b, op, make_index_sequence<parts>{}); }
+
+  template <size_t... Is>
+  static type select(const mask_type& m, const type& a, const type& b, index_sequence<Is...>) {
+    return type{{part::select(m.values[Is], a.values[Is], b.values[Is])...}};
+  }
+  static type select(const mask_type& m, const type& a, const type& b) { return select(m, a, b, make_index_sequence<parts>{}); }
+
+  static bool mask_get(const mask_type& m, size_t i) { return part::mask_get(m.values[i / W], i % W); }
+
+  template <size_t... Is>
+  static mask_type mask_and(const mask_type& a, const mask_type& b, index_sequence<Is...>) { return mask_type{{part::mask_and(a.values[Is], b.values[Is])...}}; }
+  static mask_type mask_and(const mask_type& a, const mask_type& b) { return mask_and(a, b, make_index_sequence<parts>{}); }
+
+  template <size_t... Is>
+  static mask_type mask_or(const mask_type& a, const mask_type& b, index_sequence<Is...>) { return mask_type{{part::mask_or(a.values[Is], b.values[Is])...}}; }
+  static mask_type mask_or(const mask_type& a, const mask_type& b) { return mask_or(a, b, make_index_sequence<parts>{}); }
+
+  template <size_t... Is>
+  static mask_type mask_not(const mask_type& a, index_sequence<Is...>) { return mask_type{{part::mask_not(a.values[Is])...}}; }
+  static mask_type mask_not(const mask_type& a) { return mask_not(a, make_index_sequence<parts>{}); }
+
+  static size_t mask_count(const mask_type& m) {
+    size_t count = 0;
+    for (size_t i = 0; i < parts; i++) count += part::mask_count(m.values[i]);
+    return count;
+  }
+};
+
+/// Vector extensions require power-of-two sizes, and don't support long double
+template <typename T, size_t N>
+constexpr bool is_vectorizable() {
+  return (N & (N - 1)) == 0 && (sizeof(T) & (sizeof(T) - 1)) == 0 && sizeof(T) <= 8 && !is_same_v<T, long double>();
+}
+
+/// Elements of type T in a register, at least one
+template <typename T>
+constexpr size_t simd_register_elements() { return sizeof(T) < JTC_SIMD_REGISTER_SIZE ? JTC_SIMD_REGISTER_SIZE / sizeof(T) : 1; }
+
+template <typename T, size_t N>
+struct simd_impl_selector
+    : conditional<!is_vectorizable<T, N>(), simd_array_impl<T, N>,
+                  conditional_t<(N > simd_register_elements<T>()), simd_split_impl<T, N, simd_register_elements<T>()>,
+                                simd_vector_impl<T, N>>> {};
+
+#else
+
+template <typename T, size_t N>
+struct simd_impl_selector : make_type<simd_array_impl<T, N>> {};
+
+#endif  // JTC_HAS_VECTOR_EXTENSIONS
+
+}  // namespace detail
+
+#if JTC_HAS_VECTOR_EXTENSIONS && defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+struct simd_tests {
+  static_assert(jtc::simd<float, 8>::size() == 8, "JTC test failed!");
+  static_assert(jtc::simd_mask<int, 3>::size() == 3, "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::simd<short, 4>::value_type, short>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::simd<short, 4>::mask_type, jtc::simd_mask<short, 4>>(), "JTC test failed!");
+
+  // Sizes unsupported by vector extensions use the scalar fallback
+  static_assert(!jtc::simd<int, 3>::is_native, "JTC test failed!");
+  static_assert(!jtc::simd<long double, 2>::is_native, "JTC test failed!");
+  static_assert(jtc::simd<double, 4>::alignment >= alignof(double), "JTC test failed!");
+
+#if JTC_HAS_VECTOR_EXTENSIONS
+  // Values wider than a register are split into register-sized vectors
+  static_assert(jtc::simd<float, 64>::is_native, "JTC test failed!");
+  static_assert(jtc::simd<float, 64>::alignment <= JTC_SIMD_REGISTER_SIZE, "JTC test failed!");
+#endif
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
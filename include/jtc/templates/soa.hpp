@@ -0,0 +1,508 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// soa.hpp: Structure-of-arrays containers, with one contiguous aligned array per field
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_SOA_HPP
+#define JTC_TEMPLATES_SOA_HPP
+
+#include "construct.hpp"
+#include "declval.hpp"
+#include "integer_sequence.hpp"
+#include "make_type.hpp"
+#include "move_forward.hpp"
+#include "span.hpp"
+#include "std_def.hpp"
+#include "type_list.hpp"
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// Structure of arrays
+//
+// soa_array<type_list<Fields...>, N> stores N records, where each field is stored in its own array,
+//   aligned to Align bytes (a cache line, by default). A loop that reads one field of every record
+//   only loads that field's cache lines, instead of the whole records.
+// soa_vector<type_list<Fields...>> is the growable variant, allocating all columns in a single block.
+//
+// Fields are accessed by index: get<I>(i) is the field I of the record i, and field<I>() is a span
+//   over the whole column. operator[] returns a soa_reference, a proxy to a whole record.
+//
+// Usage:
+//     using particles = soa_array<type_list<float, float, unsigned char>, 1024>;  // x, v, flags
+//     particles p;
+//     p.set(0, 1.0f, 0.5f, 0);
+//     auto x = p.field<0>();
+//     auto v = p.field<1>();
+//     for (size_t i = 0; i < x.size(); i++) x[i] += v[i];
+//-------------------------------------------------------------------------------------------------
+
+template <typename List, size_t N, size_t Align = 64>
+class soa_array;
+
+template <typename List, size_t Align = 64>
+class soa_vector;
+
+// Forward declaration of the implementation
+namespace detail {
+template <typename T, size_t Align> constexpr size_t soa_column_alignment();
+template <size_t N, size_t Align> struct soa_column_of;
+template <typename Indexes, typename Columns> struct soa_columns;
+template <size_t I, typename Column> struct soa_leaf;
+template <size_t I, typename Column> Column& soa_column_get(soa_leaf<I, Column>& leaf);
+template <size_t I, typename Column> const Column& soa_column_get(const soa_leaf<I, Column>& leaf);
+}  // namespace detail
+
+//-------------------------------------------------------------------------------------------------
+// Row proxy
+//
+// A reference to the record at index() in a SoA container. Assigning a soa_reference copies the
+//   field values, not the reference itself, so rows can be copied with 'a[i] = b[j]'.
+//-------------------------------------------------------------------------------------------------
+
+template <typename Container>
+class soa_reference {
+ public:
+  soa_reference(Container& container, size_t index) : container_(&container), index_(index) {}
+  soa_reference(const soa_reference&) = default;
+
+  /// Index of the referenced record
+  size_t index() const { return index_; }
+
+  /// Field I of the referenced record
+  template <size_t I>
+  auto get() const -> decltype(declval<Container&>().template get<I>(0)) {
+    return container_->template get<I>(index_);
+  }
+
+  /// Copies the field values of another record
+  soa_reference& operator=(const soa_reference& other) { return assign(other); }
+
+  template <typename Other>
+  soa_reference& operator=(const soa_reference<Other>& other) { return assign(other); }
+
+  /// Assigns all fields
+  template <typename... Values>
+  void set(const Values&... values) const { container_->set(index_, values...); }
+
+ private:
+  template <typename Other>
+  soa_reference& assign(const soa_reference<Other>& other) {
+    copy_fields(other, make_index_sequence<Container::field_count()>{});
+    return *this;
+  }
+
+  template <typename Other, size_t... Is>
+  void copy_fields(const soa_reference<Other>& other, index_sequence<Is...>) {
+    using expand = int[];
+    (void)expand{0, (get<Is>() = other.template get<Is>(), 0)...};
+  }
+
+  Container* container_;
+  size_t index_;
+};
+
+/// Field I of a record, as a free function
+template <size_t I, typename Container>
+inline auto get(const soa_reference<Container>& row) -> decltype(row.template get<I>()) {
+  return row.template get<I>();
+}
+
+//-------------------------------------------------------------------------------------------------
+// soa_array: fixed size, stored inline
+//
+// Like a built-in array, it always holds N records, default-initialized on construction.
+//   For a variable number of records, use soa_vector.
+//-------------------------------------------------------------------------------------------------
+
+template <typename... Fields, size_t N, size_t Align>
+class soa_array<type_list<Fields...>, N, Align> {
+  static_assert(sizeof...(Fields) > 0, "soa_array requires at least one field.");
+  static_assert(N > 0, "soa_array requires at least one element.");
+  static_assert(Align > 0 && (Align & (Align - 1)) == 0, "soa_array alignment must be a power of two.");
+
+ public:
+  /// List of the field types
+  using fields = type_list<Fields...>;
+  /// Type of the field I
+  template <size_t I> using field_t = list_get_t<fields, I>;
+
+  using reference = soa_reference<soa_array>;
+  using const_reference = soa_reference<const soa_array>;
+
+  /// Number of records
+  constexpr static size_t size() { return N; }
+
+  /// Number of fields per record
+  constexpr static size_t field_count() { return sizeof...(Fields); }
+
+  /// Alignment of the array of the field I
+  template <size_t I>
+  constexpr static size_t alignment() { return detail::soa_column_alignment<field_t<I>, Align>(); }
+
+  /// Array of the field I
+  template <size_t I> field_t<I>* data() { return detail::soa_column_get<I>(columns_).values; }
+  template <size_t I> const field_t<I>* data() const { return detail::soa_column_get<I>(columns_).values; }
+
+  /// Field I of the record i
+  template <size_t I> field_t<I>& get(size_t i) { return data<I>()[i]; }
+  template <size_t I> const field_t<I>& get(size_t i) const { return data<I>()[i]; }
+
+  /// Span over the field I of all records
+  template <size_t I> span<field_t<I>> field() { return span<field_t<I>>(data<I>(), N); }
+  template <size_t I> span<const field_t<I>> field() const { return span<const field_t<I>>(data<I>(), N); }
+
+  /// Proxy to the record i
+  reference operator[](size_t i) { return reference(*this, i); }
+  const_reference operator[](size_t i) const { return const_reference(*this, i); }
+
+  /// Assigns all fields of the record i
+  void set(size_t i, const Fields&... values) { set_fields(i, make_index_sequence<sizeof...(Fields)>{}, values...); }
+
+ private:
+  template <size_t... Is>
+  void set_fields(size_t i, index_sequence<Is...>, const Fields&... values) {
+    using expand = int[];
+    (void)expand{0, (get<Is>(i) = values, 0)...};
+  }
+
+  /// One aligned array per field, derived from the field list
+  using columns = list_transform_t<fields, detail::soa_column_of<N, Align>::template apply>;
+
+  detail::soa_columns<make_index_sequence<sizeof...(Fields)>, columns> columns_;
+};
+
+//-------------------------------------------------------------------------------------------------
+// soa_vector: growable, heap allocated
+//
+// All columns share a single allocation, made through the global operator new.
+// Capacity grows geometrically. Growth moves each field into the new block, so references,
+//   pointers and spans are invalidated by push_back, emplace_back, reserve and resize.
+//-------------------------------------------------------------------------------------------------
+
+template <typename... Fields, size_t Align>
+class soa_vector<type_list<Fields...>, Align> {
+  static_assert(sizeof...(Fields) > 0, "soa_vector requires at least one field.");
+  static_assert(Align > 0 && (Align & (Align - 1)) == 0, "soa_vector alignment must be a power of two.");
+
+  using indexes = make_index_sequence<sizeof...(Fields)>;
+
+ public:
+  using fields = type_list<Fields...>;
+  template <size_t I> using field_t = list_get_t<fields, I>;
+
+  using reference = soa_reference<soa_vector>;
+  using const_reference = soa_reference<const soa_vector>;
+
+  constexpr static size_t field_count() { return sizeof...(Fields); }
+
+  template <size_t I>
+  constexpr static size_t alignment() { return detail::soa_column_alignment<field_t<I>, Align>(); }
+
+  soa_vector() : block_(nullptr), size_(0), capacity_(0), columns_() {}
+
+  soa_vector(const soa_vector& other) : soa_vector() {
+    reserve(other.size_);
+    copy_columns(other, indexes{});
+    size_ = other.size_;
+  }
+
+  soa_vector(soa_vector&& other) noexcept : soa_vector() { swap(other); }
+
+  soa_vector& operator=(const soa_vector& other) {
+    if (this != &other) {
+      soa_vector copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  soa_vector& operator=(soa_vector&& other) noexcept {
+    soa_vector moved(jtc::move(other));
+    swap(moved);
+    return *this;
+  }
+
+  ~soa_vector() {
+    clear();
+    ::operator delete(block_);
+  }
+
+  void swap(soa_vector& other) noexcept {
+    swap_values(block_, other.block_);
+    swap_values(size_, other.size_);
+    swap_values(capacity_, other.capacity_);
+    for (size_t i = 0; i < sizeof...(Fields); i++) swap_values(columns_[i], other.columns_[i]);
+  }
+
+  size_t size() const { return size_; }
+  size_t capacity() const { return capacity_; }
+  bool empty() const { return size_ == 0; }
+
+  template <size_t I> field_t<I>* data() { return static_cast<field_t<I>*>(columns_[I]); }
+  template <size_t I> const field_t<I>* data() const { return static_cast<const field_t<I>*>(columns_[I]); }
+
+  template <size_t I> field_t<I>& get(size_t i) { return data<I>()[i]; }
+  template <size_t I> const field_t<I>& get(size_t i) const { return data<I>()[i]; }
+
+  template <size_t I> span<field_t<I>> field() { return span<field_t<I>>(data<I>(), size_); }
+  template <size_t I> span<const field_t<I>> field() const { return span<const field_t<I>>(data<I>(), size_); }
+
+  reference operator[](size_t i) { return reference(*this, i); }
+  const_reference operator[](size_t i) const { return const_reference(*this, i); }
+
+  reference back() { return reference(*this, size_ - 1); }
+  const_reference back() const { return const_reference(*this, size_ - 1); }
+
+  void set(size_t i, const Fields&... values) { set_fields(i, indexes{}, values...); }
+
+  /// Appends a record, constructing each field from the matching argument.
+  /// The arguments may refer to records of this vector, even when it grows.
+  template <typename... Args>
+  void emplace_back(Args&&... args) {
+    static_assert(sizeof...(Args) == sizeof...(Fields), "emplace_back requires one argument per field.");
+    if (size_ == capacity_) {
+      // The record is constructed in the new block before the others are relocated, and the old block freed
+      void* columns[sizeof...(Fields)];
+      const size_t capacity = grown_capacity(size_ + 1);
+      char* block = allocate(capacity, columns);
+      construct_fields(columns, size_, indexes{}, jtc::forward<Args>(args)...);
+      replace_block(block, capacity, columns);
+    } else {
+      construct_fields(columns_, size_, indexes{}, jtc::forward<Args>(args)...);
+    }
+    size_++;
+  }
+
+  void push_back(const Fields&... values) { emplace_back(values...); }
+
+  /// Removes the last record
+  void pop_back() {
+    size_--;
+    destroy_fields(size_, size_ + 1, indexes{});
+  }
+
+  /// Resizes to count records, default-constructing the new ones
+  void resize(size_t count) {
+    if (count > capacity_) grow(count);
+    if (count > size_) {
+      default_construct_fields(size_, count, indexes{});
+    } else {
+      destroy_fields(count, size_, indexes{});
+    }
+    size_ = count;
+  }
+
+  /// Grows the capacity to at least count records
+  void reserve(size_t count) {
+    if (count > capacity_) reallocate(count);
+  }
+
+  /// Removes all records, keeping the capacity
+  void clear() {
+    destroy_fields(0, size_, indexes{});
+    size_ = 0;
+  }
+
+ private:
+  template <typename T>
+  static void swap_values(T& a, T& b) {
+    T temp = a;
+    a = b;
+    b = temp;
+  }
+
+  /// Bytes of the array of the field I
+  template <size_t I>
+  static size_t column_bytes(size_t capacity) { return sizeof(field_t<I>) * capacity; }
+
+  /// Bytes of a block of all arrays, including the worst-case alignment padding of each one
+  template <size_t... Is>
+  static size_t block_bytes(size_t capacity, index_sequence<Is...>) {
+    size_t bytes = 0;
+    using expand = int[];
+    (void)expand{0, (bytes += column_bytes<Is>(capacity) + alignment<Is>() - 1, 0)...};
+    return bytes;
+  }
+
+  /// Capacity to hold at least minimum records, doubling the current one
+  size_t grown_capacity(size_t minimum) const {
+    const size_t doubled = capacity_ * 2;
+    return doubled > minimum ? doubled : (minimum < 8 ? 8 : minimum);
+  }
+
+  void grow(size_t minimum) { reallocate(grown_capacity(minimum)); }
+
+  void reallocate(size_t capacity) {
+    void* columns[sizeof...(Fields)];
+    char* block = allocate(capacity, columns);
+    replace_block(block, capacity, columns);
+  }
+
+  /// Allocates a block for capacity records, and places its columns
+  static char* allocate(size_t capacity, void** columns) {
+    char* block = static_cast<char*>(::operator new(block_bytes(capacity, indexes{})));
+    place_columns(block, capacity, columns, indexes{});
+    return block;
+  }
+
+  /// Relocates the records into a new block, and frees the current one
+  void replace_block(char* block, size_t capacity, void** columns) {
+    relocate_fields(columns, indexes{});
+    ::operator delete(block_);
+    block_ = block;
+    capacity_ = capacity;
+    for (size_t i = 0; i < sizeof...(Fields); i++) columns_[i] = columns[i];
+  }
+
+  template <size_t... Is>
+  static void place_columns(char* cursor, size_t capacity, void** columns, index_sequence<Is...>) {
+    using expand = int[];
+    (void)expand{0, (columns[Is] = align_cursor<Is>(cursor), cursor += column_bytes<Is>(capacity), 0)...};
+  }
+
+  template <size_t I>
+  static char* align_cursor(char*& cursor) {
+    const size_t misalignment = reinterpret_cast<size_t>(cursor) % alignment<I>();
+    cursor += misalignment == 0 ? 0 : alignment<I>() - misalignment;
+    return cursor;
+  }
+
+  /// Moves all fields into the new columns, destroying the old ones
+  template <size_t... Is>
+  void relocate_fields(void** columns, index_sequence<Is...>) {
+    using expand = int[];
+    (void)expand{0, (relocate_field<Is>(static_cast<field_t<Is>*>(columns[Is])), 0)...};
+  }
+
+  template <size_t I>
+  void relocate_field(field_t<I>* destination) {
+    field_t<I>* source = data<I>();
+    for (size_t i = 0; i < size_; i++) {
+      jtc::construct_at(destination + i, jtc::move(source[i]));
+      jtc::destroy_at(source + i);
+    }
+  }
+
+  template <size_t... Is>
+  void copy_columns(const soa_vector& other, index_sequence<Is...>) {
+    using expand = int[];
+    (void)expand{0, (copy_column<Is>(other), 0)...};
+  }
+
+  template <size_t I>
+  void copy_column(const soa_vector& other) {
+    for (size_t i = 0; i < other.size_; i++) jtc::construct_at(data<I>() + i, other.template get<I>(i));
+  }
+
+  /// Constructs the record i in the given columns, which may belong to a new block
+  template <size_t... Is, typename... Args>
+  static void construct_fields(void* const* columns, size_t i, index_sequence<Is...>, Args&&... args) {
+    using expand = int[];
+    (void)expand{0, (jtc::construct_at(static_cast<field_t<Is>*>(columns[Is]) + i, jtc::forward<Args>(args)), 0)...};
+  }
+
+  template <size_t... Is>
+  void default_construct_fields(size_t begin, size_t end, index_sequence<Is...>) {
+    using expand = int[];
+    (void)expand{0, (default_construct_field<Is>(begin, end), 0)...};
+  }
+
+  template <size_t I>
+  void default_construct_field(size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) jtc::construct_at(data<I>() + i);
+  }
+
+  template <size_t... Is>
+  void destroy_fields(size_t begin, size_t end, index_sequence<Is...>) {
+    using expand = int[];
+    (void)expand{0, (destroy_field<Is>(begin, end), 0)...};
+  }
+
+  template <size_t I>
+  void destroy_field(size_t begin, size_t end) {
+    if (is_trivially_destructible_v<field_t<I>>()) return;
+    for (size_t i = begin; i < end; i++) jtc::destroy_at(data<I>() + i);
+  }
+
+  template <size_t... Is>
+  void set_fields(size_t i, index_sequence<Is...>, const Fields&... values) {
+    using expand = int[];
+    (void)expand{0, (get<Is>(i) = values, 0)...};
+  }
+
+  char* block_;
+  size_t size_;
+  size_t capacity_;
+  void* columns_[sizeof...(Fields)];
+};
+
+//-------------------------------------------------------------------------------------------------
+// soa_array storage: a base class per column, indexed by the field position
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+template <typename T, size_t Align>
+constexpr size_t soa_column_alignment() { return Align > alignof(T) ? Align : alignof(T); }
+
+/// The array of a single field
+template <typename T, size_t N, size_t Align>
+struct alignas(soa_column_alignment<T, Align>()) soa_column { T values[N]; };
+
+/// list_transform operator: field type -> column type
+template <size_t N, size_t Align>
+struct soa_column_of {
+  template <typename T>
+  using apply = make_type<soa_column<T, N, Align>>;
+};
+
+template <size_t I, typename Column>
+struct soa_leaf { Column column; };
+
+template <size_t... Is, typename... Columns>
+struct soa_columns<index_sequence<Is...>, type_list<Columns...>> : soa_leaf<Is, Columns>... {};
+
+/// Column access: the leaf is deduced from I, through the derived-to-base conversion
+template <size_t I, typename Column>
+inline Column& soa_column_get(soa_leaf<I, Column>& leaf) { return leaf.column; }
+
+template <size_t I, typename Column>
+inline const Column& soa_column_get(const soa_leaf<I, Column>& leaf) { return leaf.column; }
+
+}  // namespace detail
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+struct soa_tests {
+  using particles = jtc::soa_array<jtc::type_list<float, double, char>, 10>;
+  using packed = jtc::soa_array<jtc::type_list<short, char>, 3, 1>;
+
+  static_assert(particles::size() == 10, "JTC test failed!");
+  static_assert(particles::field_count() == 3, "JTC test failed!");
+  static_assert(jtc::is_same_v<particles::field_t<1>, double>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::soa_vector<jtc::type_list<int, char>>::field_t<1>, char>(), "JTC test failed!");
+
+  // Column alignment: at least Align, and at least the field's alignment
+  static_assert(particles::alignment<2>() == 64, "JTC test failed!");
+  static_assert(alignof(particles) == 64, "JTC test failed!");
+  static_assert(packed::alignment<0>() == alignof(short), "JTC test failed!");
+  static_assert(alignof(packed) == alignof(short), "JTC test failed!");
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
@@ -0,0 +1,226 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// sort_network.hpp: Compile-time generated sorting networks for small fixed-size arrays
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_SORT_NETWORK_HPP
+#define JTC_TEMPLATES_SORT_NETWORK_HPP
+
+#include "cv_ref_traits.hpp"
+#include "integer_sequence.hpp"
+#include "number_traits.hpp"
+#include "std_def.hpp"
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// Sorting networks
+//
+// sort_network<N> sorts N elements with a fixed sequence of compare-exchange operations,
+//   generated at compile time with Batcher's merge-exchange algorithm (Knuth, TAOCP 5.2.2, Algorithm M).
+// The network is optimal for N <= 8 (e.g. 19 comparators for N = 8), and close to the best known
+//   networks up to N = 32 (63 comparators for N = 16, 191 for N = 32).
+//
+// Each compare-exchange is a pair of min/max selections, with indexes known at compile time:
+//   there are no loops or data-dependent branches, so the compiler emits cmov/min/max instructions.
+// The order of NaN values in floating-point inputs is unspecified.
+//
+// Usage:
+//     int window[9] = {...};
+//     network_sort(window);
+//     int median = window[4];
+//-------------------------------------------------------------------------------------------------
+
+// Forward declarations of the implementation
+namespace detail {
+constexpr size_t sort_network_top(size_t n, size_t t = 1);
+constexpr size_t sort_network_count(size_t n, size_t p, size_t q, size_t r, size_t d, size_t top);
+constexpr size_t sort_network_depth(size_t n, size_t p, size_t q, size_t top);
+constexpr size_t sort_network_low(size_t n, size_t k, size_t p, size_t q, size_t r, size_t d, size_t top);
+constexpr size_t sort_network_distance(size_t n, size_t k, size_t p, size_t q, size_t r, size_t d, size_t top);
+template <size_t N, typename T, size_t... Ks>
+void sort_network_apply(T* data, index_sequence<Ks...>);
+}  // namespace detail
+
+template <size_t N>
+struct sort_network {
+  /// Number of elements sorted by the network
+  constexpr static size_t size() { return N; }
+
+  /// Number of compare-exchange operations
+  constexpr static size_t comparator_count() {
+    return detail::sort_network_count(N, top, top, 0, top, top);
+  }
+
+  /// Number of parallel layers: comparators in the same layer are independent
+  constexpr static size_t depth() { return detail::sort_network_depth(N, top, top, top); }
+
+  /// Indexes compared by the k-th comparator, where low(k) < high(k)
+  constexpr static size_t low(size_t k) { return detail::sort_network_low(N, k, top, top, 0, top, top); }
+  constexpr static size_t high(size_t k) { return low(k) + detail::sort_network_distance(N, k, top, top, 0, top, top); }
+
+  /// Sorts the N elements starting at data, in ascending order
+  template <typename T>
+  static void sort(T* data) {
+    static_assert(is_arithmetic_v<T>() && !is_const_v<T>(), "sort_network requires a mutable arithmetic type.");
+    detail::sort_network_apply<N>(data, make_index_sequence<comparator_count()>{});
+  }
+
+ private:
+  /// Largest power of two smaller than N, the starting distance of the network
+  constexpr static size_t top = detail::sort_network_top(N);
+};
+
+template <size_t N>
+constexpr size_t sort_network<N>::top;
+
+/// Sorts an array in ascending order, with the sorting network for its size
+template <typename T, size_t N>
+inline void network_sort(T (&data)[N]) {
+  sort_network<N>::sort(data);
+}
+
+//-------------------------------------------------------------------------------------------------
+// Network generation
+//
+// Algorithm M is a sequence of passes, each one a layer of independent comparators (i, i + d),
+//   for every i in [0, n - d) where (i & p) == r. A pass is identified by (p, q, r, d):
+//   - The first pass is (top, top, 0, top).
+//   - After a pass where q != p, the next pass is (p, q / 2, p, q - p).
+//   - After a pass where q == p, the next pass is (p / 2, top, 0, p / 2). The network ends when p is 0.
+// The k-th comparator is found by skipping whole passes, then searching the matching indexes.
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+constexpr size_t sort_network_top(size_t n, size_t t) {
+  return t >= n ? t / 2 : sort_network_top(n, t * 2);
+}
+
+/// Number of comparators in the pass (p, r, d), starting the search from the index i
+constexpr size_t sort_network_pass_count(size_t n, size_t p, size_t r, size_t d, size_t i = 0) {
+  return i + d >= n ? 0 : ((i & p) == r ? 1 : 0) + sort_network_pass_count(n, p, r, d, i + 1);
+}
+
+/// Lower index of the k-th comparator in the pass (p, r, d), starting the search from the index i
+constexpr size_t sort_network_pass_low(size_t p, size_t r, size_t k, size_t i = 0) {
+  return (i & p) != r ? sort_network_pass_low(p, r, k, i + 1)
+                      : k == 0 ? i : sort_network_pass_low(p, r, k - 1, i + 1);
+}
+
+constexpr size_t sort_network_count(size_t n, size_t p, size_t q, size_t r, size_t d, size_t top) {
+  return p == 0 ? 0
+                : sort_network_pass_count(n, p, r, d) +
+                      (q == p ? sort_network_count(n, p / 2, top, 0, p / 2, top)
+                              : sort_network_count(n, p, q / 2, p, q - p, top));
+}
+
+constexpr size_t sort_network_depth(size_t n, size_t p, size_t q, size_t top) {
+  return p == 0 ? 0 : 1 + (q == p ? sort_network_depth(n, p / 2, top, top) : sort_network_depth(n, p, q / 2, top));
+}
+
+constexpr size_t sort_network_low(size_t n, size_t k, size_t p, size_t q, size_t r, size_t d, size_t top) {
+  return p == 0 ? n
+         : k < sort_network_pass_count(n, p, r, d) ? sort_network_pass_low(p, r, k)
+         : q == p ? sort_network_low(n, k - sort_network_pass_count(n, p, r, d), p / 2, top, 0, p / 2, top)
+                  : sort_network_low(n, k - sort_network_pass_count(n, p, r, d), p, q / 2, p, q - p, top);
+}
+
+constexpr size_t sort_network_distance(size_t n, size_t k, size_t p, size_t q, size_t r, size_t d, size_t top) {
+  return p == 0 ? 0
+         : k < sort_network_pass_count(n, p, r, d) ? d
+         : q == p ? sort_network_distance(n, k - sort_network_pass_count(n, p, r, d), p / 2, top, 0, p / 2, top)
+                  : sort_network_distance(n, k - sort_network_pass_count(n, p, r, d), p, q / 2, p, q - p, top);
+}
+
+//-------------------------------------------------------------------------------------------------
+// Network application
+//-------------------------------------------------------------------------------------------------
+
+/// Branchless compare-exchange: data[Low] = min, data[High] = max
+template <size_t Low, size_t High, typename T>
+inline void sort_network_exchange(T* data) {
+  const T a = data[Low];
+  const T b = data[High];
+  data[Low] = b < a ? b : a;
+  data[High] = b < a ? a : b;
+}
+
+/// Expands to every comparator, in order
+template <size_t N, typename T, size_t... Ks>
+inline void sort_network_apply(T* data, index_sequence<Ks...>) {
+  using expand = int[];
+  (void)expand{0, (sort_network_exchange<sort_network<N>::low(Ks), sort_network<N>::high(Ks)>(data), 0)...};
+  (void)data;  // Unused for N <= 1, where there are no comparators
+}
+
+}  // namespace detail
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+// By the 0-1 principle, a network that sorts every sequence of zeros and ones sorts any sequence.
+// Sequences are bitmasks, where bit i is the element i.
+namespace sort_network_helpers {
+template <size_t N>
+constexpr unsigned long exchange(unsigned long x, size_t k) {
+  return ((x >> jtc::sort_network<N>::low(k)) & 1) > ((x >> jtc::sort_network<N>::high(k)) & 1)
+             ? x ^ (1ul << jtc::sort_network<N>::low(k)) ^ (1ul << jtc::sort_network<N>::high(k))
+             : x;
+}
+
+template <size_t N>
+constexpr unsigned long apply(unsigned long x, size_t k = 0) {
+  return k == jtc::sort_network<N>::comparator_count() ? x : apply<N>(exchange<N>(x, k), k + 1);
+}
+
+/// Sorted: all ones are above all zeros
+template <size_t N>
+constexpr bool is_sorted(unsigned long x) {
+  return ((x << 1) & ((1ul << N) - 1) & ~x) == 0;
+}
+
+template <size_t N>
+constexpr bool sorts_all(unsigned long x = 0) {
+  return x == (1ul << N) || (is_sorted<N>(apply<N>(x)) && sorts_all<N>(x + 1));
+}
+}  // namespace sort_network_helpers
+
+struct sort_network_tests {
+  // Network sizes
+  static_assert(jtc::sort_network<0>::comparator_count() == 0, "JTC test failed!");
+  static_assert(jtc::sort_network<1>::comparator_count() == 0, "JTC test failed!");
+  static_assert(jtc::sort_network<2>::comparator_count() == 1, "JTC test failed!");
+  static_assert(jtc::sort_network<4>::comparator_count() == 5, "JTC test failed!");
+  static_assert(jtc::sort_network<8>::comparator_count() == 19, "JTC test failed!");
+  static_assert(jtc::sort_network<16>::comparator_count() == 63, "JTC test failed!");
+  static_assert(jtc::sort_network<4>::depth() == 3, "JTC test failed!");
+  static_assert(jtc::sort_network<8>::depth() == 6, "JTC test failed!");
+
+  // Comparators
+  static_assert(jtc::sort_network<2>::low(0) == 0 && jtc::sort_network<2>::high(0) == 1, "JTC test failed!");
+  static_assert(jtc::sort_network<5>::high(0) == 4, "JTC test failed!");
+
+  // Correctness, including sizes that aren't powers of two
+  static_assert(sort_network_helpers::sorts_all<3>(), "JTC test failed!");
+  static_assert(sort_network_helpers::sorts_all<5>(), "JTC test failed!");
+  static_assert(sort_network_helpers::sorts_all<6>(), "JTC test failed!");
+  static_assert(sort_network_helpers::sorts_all<7>(), "JTC test failed!");
+  static_assert(sort_network_helpers::sorts_all<8>(), "JTC test failed!");
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
@@ -0,0 +1,100 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// span.hpp: Emulates C++20's std::span, for contiguous sequences with a runtime size
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_SPAN_HPP
+#define JTC_TEMPLATES_SPAN_HPP
+
+#include "cv_ref_traits.hpp"
+#include "std_def.hpp"
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// span definition
+//
+// A non-owning view of Size contiguous elements of type T. Only the dynamic extent is implemented.
+//
+// Usage:
+//     int values[4] = {1, 2, 3, 4};
+//     span<int> view(values);
+//     for (int& v : view) v *= 2;
+//-------------------------------------------------------------------------------------------------
+
+template <typename T>
+class span {
+ public:
+  using element_type = T;
+  using value_type = remove_cv_t<T>;
+  using pointer = T*;
+  using reference = T&;
+  using iterator = T*;
+
+  /// Empty span
+  constexpr span() noexcept : data_(nullptr), size_(0) {}
+
+  /// View of size elements starting at data
+  constexpr span(T* data, size_t size) noexcept : data_(data), size_(size) {}
+
+  /// View of an array
+  template <size_t N>
+  constexpr span(T (&array)[N]) noexcept : data_(array), size_(N) {}
+
+  /// Conversion from span<U>, e.g. span<int> to span<const int>
+  template <typename U, typename = decltype(static_cast<T*>(static_cast<U*>(nullptr)))>
+  constexpr span(const span<U>& other) noexcept : data_(other.data()), size_(other.size()) {}
+
+  constexpr T* data() const noexcept { return data_; }
+  constexpr size_t size() const noexcept { return size_; }
+  constexpr size_t size_bytes() const noexcept { return size_ * sizeof(T); }
+  constexpr bool empty() const noexcept { return size_ == 0; }
+
+  constexpr T& operator[](size_t index) const { return data_[index]; }
+  constexpr T& front() const { return data_[0]; }
+  constexpr T& back() const { return data_[size_ - 1]; }
+
+  constexpr T* begin() const noexcept { return data_; }
+  constexpr T* end() const noexcept { return data_ + size_; }
+
+  /// Sub-views
+  constexpr span first(size_t count) const { return span(data_, count); }
+  constexpr span last(size_t count) const { return span(data_ + (size_ - count), count); }
+  constexpr span subspan(size_t offset, size_t count) const { return span(data_ + offset, count); }
+
+ private:
+  T* data_;
+  size_t size_;
+};
+
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+namespace span_helpers {
+constexpr int values[4] = {1, 2, 3, 4};
+}
+
+struct span_tests {
+  static_assert(jtc::span<const int>(span_helpers::values).size() == 4, "JTC test failed!");
+  static_assert(jtc::span<const int>(span_helpers::values)[2] == 3, "JTC test failed!");
+  static_assert(jtc::span<const int>(span_helpers::values).last(1).front() == 4, "JTC test failed!");
+  static_assert(jtc::span<const int>(span_helpers::values).subspan(1, 2).size_bytes() == 2 * sizeof(int), "JTC test failed!");
+  static_assert(jtc::span<int>().empty(), "JTC test failed!");
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
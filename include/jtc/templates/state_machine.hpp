@@ -0,0 +1,305 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// state_machine.hpp: Table-driven finite state machines, compiled from a type_list of transitions
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_STATE_MACHINE_HPP
+#define JTC_TEMPLATES_STATE_MACHINE_HPP
+
+#include "conditional.hpp"
+#include "integer_sequence.hpp"
+#include "integral_constant.hpp"
+#include "is_same.hpp"
+#include "lookup_table.hpp"
+#include "std_def.hpp"
+#include "type_id.hpp"
+#include "type_list.hpp"
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// Transitions
+//
+// transition<From, Event, To, Action>: when Event happens in the state From, the machine goes to
+//   the state To, then calls Action{}(context, event). States and events are arbitrary types.
+//-------------------------------------------------------------------------------------------------
+
+/// Default action: does nothing
+struct fsm_no_action {
+  template <typename Context, typename Event>
+  void operator()(Context&, const Event&) const {}
+};
+
+template <typename From, typename Event, typename To, typename Action = fsm_no_action>
+struct transition {
+  using from = From;
+  using event = Event;
+  using to = To;
+  using action = Action;
+};
+
+/// Policies for (state, event) pairs without a transition
+struct fsm_allow_unhandled {};   // The event is ignored, and the state doesn't change
+struct fsm_require_complete {};  // Compile-time error
+
+//-------------------------------------------------------------------------------------------------
+// state_machine definition
+//
+// The states are the From and To types of all transitions, in order of appearance; the initial
+//   state is the From state of the first transition. The events are the Event types of all transitions.
+// All transitions are compiled into a dense [state][event] table of next-state IDs and action
+//   function pointers, so process() is a single table lookup and an indirect call, with no branches
+//   on the state. The current state is stored in type_id_t<states>: a byte, for up to 256 states.
+//
+// Two transitions from the same state with the same event are a compile-time error.
+//
+// Usage:
+//     struct idle {}; struct connecting {}; struct online {};
+//     struct dial {}; struct ack {}; struct hang_up {};
+//     struct on_online { void operator()(modem& m, const ack&) const { m.led(true); } };
+//
+//     using modem_fsm = state_machine<modem, type_list<
+//         transition<idle, dial, connecting>,
+//         transition<connecting, ack, online, on_online>,
+//         transition<online, hang_up, idle>>>;
+//
+//     modem_fsm fsm;
+//     fsm.process(my_modem, dial{});
+//     fsm.process(my_modem, ack{});  // Calls on_online
+//     bool ok = fsm.is_in<online>();
+//-------------------------------------------------------------------------------------------------
+
+template <typename Context, typename Transitions, typename Policy = fsm_allow_unhandled>
+class state_machine;
+
+// Forward declaration of the implementation
+namespace detail {
+template <typename Transitions, typename From, typename Event> struct fsm_match_count;
+template <typename Machine, typename Indexes> struct fsm_table_builder;
+template <typename Transitions, typename States, typename Events, typename Indexes> struct fsm_counts;
+}  // namespace detail
+
+template <typename Context, typename... Transitions, typename Policy>
+class state_machine<Context, type_list<Transitions...>, Policy> {
+  static_assert(sizeof...(Transitions) > 0, "A state_machine requires at least one transition.");
+
+ public:
+  using context_type = Context;
+  using transitions = type_list<Transitions...>;
+
+  /// All states, in order of appearance. The first one is the initial state.
+  using states = list_unique_t<type_list<typename Transitions::from..., typename Transitions::to...>>;
+
+  /// All events, in order of appearance
+  using events = list_unique_t<type_list<typename Transitions::event...>>;
+
+  /// Storage type of state IDs
+  using state_id = type_id_t<states>;
+
+  /// An entry of the transition table
+  struct entry {
+    state_id next;
+    bool handled;
+    void (*action)(Context&, const void*);
+  };
+
+ private:
+  using counts = detail::fsm_counts<transitions, states, events, make_index_sequence<states::size * events::size>>;
+
+  static_assert(counts::max <= 1, "Duplicate transition: the same (state, event) pair has more than one transition.");
+  static_assert(!is_same_v<Policy, fsm_require_complete>() || counts::unhandled == 0,
+                "Missing transition: some (state, event) pairs have no transition.");
+
+ public:
+  /// The transition table, indexed by [state * events::size + event]
+  constexpr static lookup_table<entry, states::size * events::size> table =
+      detail::fsm_table_builder<state_machine, make_index_sequence<states::size * events::size>>::make();
+
+  /// Number of (state, event) pairs without a transition
+  constexpr static size_t unhandled_count() { return counts::unhandled; }
+
+  /// Whether every state handles every event
+  constexpr static bool is_complete() { return counts::unhandled == 0; }
+
+  /// Starts at the initial state
+  constexpr state_machine() : state_(0) {}
+
+  /// A machine starting at State
+  template <typename State>
+  constexpr static state_machine starting_at() { return state_machine(type_id_v<states, State>()); }
+
+  /// ID of the current state
+  constexpr state_id state() const { return state_; }
+
+  /// Tag of the current state
+  constexpr type_tag<states> state_tag() const { return type_tag<states>::from_id(state_); }
+
+  /// Whether the current state is State
+  template <typename State>
+  constexpr bool is_in() const { return state_ == type_id_v<states, State>(); }
+
+  /// Processes event: moves to the next state, then calls the transition's action.
+  /// Returns whether the current state has a transition for the event.
+  template <typename Event>
+  bool process(Context& context, const Event& event) {
+    const entry& e = table[state_ * events::size + type_id_v<events, Event>()];
+    state_ = e.next;
+    e.action(context, &event);
+    return e.handled;
+  }
+
+ private:
+  constexpr explicit state_machine(state_id state) : state_(state) {}
+
+  state_id state_;
+};
+
+template <typename Context, typename... Transitions, typename Policy>
+constexpr lookup_table<typename state_machine<Context, type_list<Transitions...>, Policy>::entry,
+                       state_machine<Context, type_list<Transitions...>, Policy>::states::size *
+                           state_machine<Context, type_list<Transitions...>, Policy>::events::size>
+    state_machine<Context, type_list<Transitions...>, Policy>::table;
+
+//-------------------------------------------------------------------------------------------------
+// Implementation
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+/// Search operator: transitions from From, with the event Event
+template <typename From, typename Event>
+struct fsm_match {
+  template <typename T>
+  using match = bool_constant<is_same_v<typename T::from, From>() && is_same_v<typename T::event, Event>()>;
+};
+
+/// Number of true values
+constexpr size_t fsm_count_of() { return 0; }
+template <typename... Bools>
+constexpr size_t fsm_count_of(bool value, Bools... values) { return (value ? 1 : 0) + fsm_count_of(values...); }
+
+template <typename From, typename Event, typename... Transitions>
+struct fsm_match_count<type_list<Transitions...>, From, Event>
+    : integral_constant<size_t, fsm_count_of(fsm_match<From, Event>::template match<Transitions>::value...)> {};
+
+/// Maximum number of transitions per cell, and number of cells without transitions
+constexpr size_t fsm_max(size_t a, size_t b) { return a > b ? a : b; }
+constexpr size_t fsm_max_of() { return 0; }
+template <typename... Counts>
+constexpr size_t fsm_max_of(size_t count, Counts... counts) { return fsm_max(count, fsm_max_of(counts...)); }
+constexpr size_t fsm_zeros_of() { return 0; }
+template <typename... Counts>
+constexpr size_t fsm_zeros_of(size_t count, Counts... counts) { return (count == 0 ? 1 : 0) + fsm_zeros_of(counts...); }
+
+template <typename Transitions, typename States, typename Events, size_t... Cells>
+struct fsm_counts<Transitions, States, Events, index_sequence<Cells...>> {
+  constexpr static size_t max = fsm_max_of(
+      fsm_match_count<Transitions, list_get_t<States, Cells / Events::size>, list_get_t<Events, Cells % Events::size>>::value...);
+  constexpr static size_t unhandled = fsm_zeros_of(
+      fsm_match_count<Transitions, list_get_t<States, Cells / Events::size>, list_get_t<Events, Cells % Events::size>>::value...);
+};
+
+/// Calls Action with the type-erased event, restored to its type
+template <typename Action, typename Context, typename Event>
+void fsm_invoke(Context& context, const void* event) {
+  Action{}(context, *static_cast<const Event*>(event));
+}
+
+/// Action of the cells without a transition
+template <typename Context>
+void fsm_ignore(Context&, const void*) {}
+
+/// Entry of a cell with a transition
+template <typename Machine, typename Transition, bool Found = true>
+struct fsm_cell {
+  constexpr static typename Machine::entry make(size_t) {
+    return typename Machine::entry{type_id_v<typename Machine::states, typename Transition::to>(), true,
+                                   &fsm_invoke<typename Transition::action, typename Machine::context_type,
+                                               typename Transition::event>};
+  }
+};
+
+/// Entry of a cell without a transition: stays in the same state
+template <typename Machine, typename Transition>
+struct fsm_cell<Machine, Transition, false> {
+  constexpr static typename Machine::entry make(size_t state) {
+    return typename Machine::entry{static_cast<typename Machine::state_id>(state), false,
+                                   &fsm_ignore<typename Machine::context_type>};
+  }
+};
+
+/// State and event of a cell
+template <typename Machine, size_t Cell>
+struct fsm_cell_key {
+  using state = list_get_t<typename Machine::states, Cell / Machine::events::size>;
+  using event = list_get_t<typename Machine::events, Cell % Machine::events::size>;
+  constexpr static bool found = fsm_match_count<typename Machine::transitions, state, event>::value != 0;
+};
+
+template <typename Machine, size_t Cell, bool Found = fsm_cell_key<Machine, Cell>::found>
+struct fsm_cell_select
+    : fsm_cell<Machine,
+               list_find_where_t<typename Machine::transitions,
+                                 fsm_match<typename fsm_cell_key<Machine, Cell>::state,
+                                           typename fsm_cell_key<Machine, Cell>::event>::template match>> {};
+
+template <typename Machine, size_t Cell>
+struct fsm_cell_select<Machine, Cell, false> : fsm_cell<Machine, void, false> {};
+
+template <typename Machine, size_t... Cells>
+struct fsm_table_builder<Machine, index_sequence<Cells...>> {
+  using table_type = lookup_table<typename Machine::entry, sizeof...(Cells)>;
+
+  constexpr static table_type make() {
+    return table_type{{fsm_cell_select<Machine, Cells>::make(Cells / Machine::events::size)...}};
+  }
+};
+
+}  // namespace detail
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+namespace state_machine_helpers {
+struct idle {}; struct running {}; struct done {};
+struct start {}; struct finish {}; struct reset {};
+
+using machine = jtc::state_machine<int, jtc::type_list<jtc::transition<idle, start, running>,
+                                                       jtc::transition<running, finish, done>,
+                                                       jtc::transition<done, reset, idle>>>;
+}  // namespace state_machine_helpers
+
+struct state_machine_tests {
+  using machine = state_machine_helpers::machine;
+  using idle = state_machine_helpers::idle;
+  using running = state_machine_helpers::running;
+  using done = state_machine_helpers::done;
+
+  static_assert(jtc::is_same_v<machine::states, jtc::type_list<idle, running, done>>(), "JTC test failed!");
+  static_assert(machine::events::size == 3, "JTC test failed!");
+  static_assert(sizeof(machine) == 1, "JTC test failed!");
+  static_assert(machine().is_in<idle>(), "JTC test failed!");
+  static_assert(machine::starting_at<done>().state() == 2, "JTC test failed!");
+
+  // Table: 3 transitions out of 9 cells
+  static_assert(machine::unhandled_count() == 6 && !machine::is_complete(), "JTC test failed!");
+  static_assert(machine::table[0 * 3 + 0].next == 1 && machine::table[0].handled, "JTC test failed!");
+  static_assert(machine::table[0 * 3 + 1].next == 0 && !machine::table[1].handled, "JTC test failed!");
+  static_assert(machine::table[2 * 3 + 2].next == 0, "JTC test failed!");
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
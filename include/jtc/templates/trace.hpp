@@ -0,0 +1,424 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// trace.hpp: Scoped tracing probes, timed with the cycle counter, that compile to nothing unless enabled
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_TRACE_HPP
+#define JTC_TEMPLATES_TRACE_HPP
+
+#include "std_def.hpp"
+#include "std_int.hpp"
+#include "varint.hpp"
+
+// Probes are only compiled when JTC_TRACE is defined. Otherwise, JTC_TRACE_SCOPE expands to nothing.
+// JTC_TRACE_CAPACITY is the number of events kept by each thread, a power of two.
+// JTC_TRACE_MAX_PROBES is the number of distinct probes in a dump. Events of other probes are skipped.
+#ifndef JTC_TRACE_CAPACITY
+#define JTC_TRACE_CAPACITY 4096
+#endif
+
+#ifndef JTC_TRACE_MAX_PROBES
+#define JTC_TRACE_MAX_PROBES 64
+#endif
+
+// The counter source: the time-stamp counter on x86, or the virtual counter on ARMv8. They need no headers,
+//   so JTC_TRACE_COUNTER is always defined there, e.g. for benchmarks. Elsewhere, probes use CLOCK_MONOTONIC.
+#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+#define JTC_TRACE_COUNTER
+#elif defined(JTC_TRACE)
+#include <time.h>
+#define JTC_TRACE_COUNTER
+#endif
+
+#define JTC_TRACE_CONCAT_IMPL(a, b) a##b
+#define JTC_TRACE_CONCAT(a, b) JTC_TRACE_CONCAT_IMPL(a, b)
+
+#ifdef JTC_TRACE
+#define JTC_TRACE_SCOPE(name)                                                                 \
+  static constexpr ::jtc::trace::probe_info JTC_TRACE_CONCAT(jtc_trace_info_, __LINE__){name}; \
+  const ::jtc::trace::scoped_probe JTC_TRACE_CONCAT(jtc_trace_probe_, __LINE__)(&JTC_TRACE_CONCAT(jtc_trace_info_, __LINE__))
+#else
+#define JTC_TRACE_SCOPE(name) static_cast<void>(0)
+#endif
+
+namespace jtc {
+namespace trace {
+
+//-------------------------------------------------------------------------------------------------
+// Probes
+//
+// JTC_TRACE_SCOPE(name) times the rest of the enclosing scope, and records it in the calling thread's ring.
+//   The name must be a string literal. The probe's identity is the address of a static constant,
+//   so there's no registration, and recording is two counter reads and three stores.
+// Each thread keeps its last JTC_TRACE_CAPACITY events. Older events are overwritten.
+//
+// Usage:
+//     void filter(sample* samples, size_t count) {
+//       JTC_TRACE_SCOPE("filter");
+//       ...
+//     }
+//
+//     unsigned char buffer[1 << 16];
+//     size_t size = trace::dump(buffer, sizeof(buffer));  // The calling thread's events
+//-------------------------------------------------------------------------------------------------
+
+/// Source of the timestamps, recorded in dumps so durations can be interpreted
+enum class clock_source : uint8_t { cycles, virtual_counter, nanoseconds };
+
+struct probe_info {
+  const char* name;
+};
+
+#ifdef JTC_TRACE_COUNTER
+
+/// Current value of the counter
+inline uint64_t now() {
+#if defined(__x86_64__) || defined(__i386__)
+  uint32_t low, high;
+  __asm__ __volatile__("rdtsc" : "=a"(low), "=d"(high));
+  return (static_cast<uint64_t>(high) << 32) | low;
+#elif defined(__aarch64__)
+  uint64_t value;
+  __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(value));
+  return value;
+#else
+  timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return static_cast<uint64_t>(time.tv_sec) * 1000000000u + static_cast<uint64_t>(time.tv_nsec);
+#endif
+}
+
+/// Source of now(), and its frequency in Hz (0 when unknown, as for the time-stamp counter)
+inline clock_source source() {
+#if defined(__x86_64__) || defined(__i386__)
+  return clock_source::cycles;
+#elif defined(__aarch64__)
+  return clock_source::virtual_counter;
+#else
+  return clock_source::nanoseconds;
+#endif
+}
+
+inline uint64_t frequency() {
+#if defined(__x86_64__) || defined(__i386__)
+  return 0;
+#elif defined(__aarch64__)
+  uint64_t value;
+  __asm__ __volatile__("mrs %0, cntfrq_el0" : "=r"(value));
+  return value;
+#else
+  return 1000000000u;
+#endif
+}
+
+#endif  // JTC_TRACE_COUNTER
+
+#ifdef JTC_TRACE
+
+struct event {
+  const probe_info* probe;
+  uint64_t start;
+  uint64_t duration;
+};
+
+/// Events of one thread. It's only written and dumped by its thread, so it needs no locks or atomics.
+struct ring {
+  static_assert((JTC_TRACE_CAPACITY & (JTC_TRACE_CAPACITY - 1)) == 0, "JTC_TRACE_CAPACITY must be a power of two.");
+  constexpr static size_t capacity = JTC_TRACE_CAPACITY;
+
+  event events[capacity];
+  uint64_t head;
+
+  void push(const probe_info* probe, uint64_t start, uint64_t duration) {
+    event& e = events[head & (capacity - 1)];
+    e.probe = probe;
+    e.start = start;
+    e.duration = duration;
+    head++;
+  }
+
+  size_t size() const { return head < capacity ? static_cast<size_t>(head) : capacity; }
+
+  /// i-th event, from the oldest one kept
+  const event& operator[](size_t i) const { return events[(head - size() + i) & (capacity - 1)]; }
+};
+
+/// The calling thread's ring. It's zero-initialized, so access needs no initialization guard.
+inline ring& this_thread_ring() {
+  static thread_local ring instance;
+  return instance;
+}
+
+class scoped_probe {
+ public:
+  explicit scoped_probe(const probe_info* probe) : probe_(probe), start_(now()) {}
+  ~scoped_probe() { this_thread_ring().push(probe_, start_, now() - start_); }
+
+  scoped_probe(const scoped_probe&) = delete;
+  scoped_probe& operator=(const scoped_probe&) = delete;
+
+ private:
+  const probe_info* probe_;
+  uint64_t start_;
+};
+
+#endif  // JTC_TRACE
+
+//-------------------------------------------------------------------------------------------------
+// Binary format
+//
+// Integers are varints, and signed ones are zigzag-encoded:
+//   - Header: "JTCT", version (1 byte), clock_source (1 byte), frequency in Hz (0 if unknown).
+//   - Probes: count, then the length and bytes of each name.
+//   - Events: count, then for each event, oldest first: the probe index, the start relative to the
+//     previous event's start (signed, as nested scopes end before their parents), and the duration.
+// A typical event takes 4 to 6 bytes, instead of the 24 bytes it takes in the ring.
+//-------------------------------------------------------------------------------------------------
+
+inline constexpr uint8_t format_version() { return 1; }
+
+#ifdef JTC_TRACE
+
+/// Writes the calling thread's events to buffer. Returns the size written, or 0 if buffer is too small.
+inline size_t dump(unsigned char* buffer, size_t capacity);
+
+#endif  // JTC_TRACE
+
+//-------------------------------------------------------------------------------------------------
+// Decoding
+//
+// profile<MaxProbes> decodes a dump into one histogram of durations per probe.
+// Histograms have a bucket per power of two: bucket 0 counts durations of 0,
+//   and bucket b counts durations in [2^(b-1), 2^b).
+// Names point into the decoded buffer, which must outlive the profile.
+//
+// Usage:
+//     trace::profile<> p;
+//     if (p.decode(buffer, size)) {
+//       for (size_t i = 0; i < p.probe_count(); i++)
+//         printf("%.*s: %llu calls, p99 < %llu\n", (int)p.name_size(i), p.name(i),
+//                p.durations(i).count, p.durations(i).percentile(99));
+//     }
+//-------------------------------------------------------------------------------------------------
+
+/// Histogram bucket of a duration: its bit width
+constexpr size_t histogram_bucket(uint64_t duration, size_t bucket = 0) {
+  return duration == 0 ? bucket : histogram_bucket(duration >> 1, bucket + 1);
+}
+
+struct histogram {
+  constexpr static size_t bucket_count = 65;
+
+  uint64_t buckets[bucket_count];
+  uint64_t count;
+  uint64_t total;
+  uint64_t min;
+  uint64_t max;
+
+  void add(uint64_t duration) {
+    buckets[histogram_bucket(duration)]++;
+    min = count == 0 || duration < min ? duration : min;
+    max = count == 0 || duration > max ? duration : max;
+    total += duration;
+    count++;
+  }
+
+  uint64_t mean() const { return count == 0 ? 0 : total / count; }
+
+  /// Upper bound of the bucket holding the given percentile, in [0, 100], and at most max
+  uint64_t percentile(unsigned p) const {
+    const uint64_t target = (count * p + 99) / 100;
+    uint64_t seen = 0;
+    for (size_t b = 0; b < bucket_count; b++) {
+      seen += buckets[b];
+      if (seen < target || seen == 0) continue;
+      const uint64_t bound = b == 0 ? 0 : b == 64 ? max : (uint64_t(1) << b) - 1;
+      return bound < max ? bound : max;
+    }
+    return max;
+  }
+};
+
+template <size_t MaxProbes = JTC_TRACE_MAX_PROBES>
+class profile {
+ public:
+  /// Decodes a dump, replacing any previous contents. Returns false if the data is malformed.
+  bool decode(const unsigned char* data, size_t size) {
+    const unsigned char* in = data;
+    const unsigned char* end = data + size;
+    clear();
+
+    if (size < 6 || in[0] != 'J' || in[1] != 'T' || in[2] != 'C' || in[3] != 'T' || in[4] != format_version())
+      return false;
+    source_ = static_cast<clock_source>(in[5]);
+    in += 6;
+
+    uint64_t probes = 0;
+    if (!(in = varint_decode(in, end, frequency_)) || !(in = varint_decode(in, end, probes)) || probes > MaxProbes)
+      return false;
+    for (size_t i = 0; i < probes; i++) {
+      uint64_t length = 0;
+      if (!(in = varint_decode(in, end, length)) || length > static_cast<uint64_t>(end - in)) return false;
+      names_[i] = reinterpret_cast<const char*>(in);
+      name_sizes_[i] = static_cast<size_t>(length);
+      in += length;
+    }
+    probe_count_ = static_cast<size_t>(probes);
+
+    uint64_t events = 0;
+    if (!(in = varint_decode(in, end, events))) return false;
+    for (uint64_t i = 0; i < events; i++) {
+      uint64_t probe = 0, duration = 0;
+      int64_t delta = 0;
+      if (!(in = varint_decode(in, end, probe)) || !(in = varint_decode(in, end, delta)) ||
+          !(in = varint_decode(in, end, duration)) || probe >= probes)
+        return false;
+      histograms_[probe].add(duration);
+    }
+    return in == end;
+  }
+
+  /// Empties the profile
+  void clear() {
+    for (size_t i = 0; i < probe_count_; i++) histograms_[i] = histogram();
+    probe_count_ = 0;
+  }
+
+  size_t probe_count() const { return probe_count_; }
+  const char* name(size_t i) const { return names_[i]; }
+  size_t name_size(size_t i) const { return name_sizes_[i]; }
+  const histogram& durations(size_t i) const { return histograms_[i]; }
+
+  /// Unit of the durations: clock_source::cycles, or a counter with frequency() ticks per second
+  clock_source source() const { return source_; }
+  uint64_t frequency() const { return frequency_; }
+
+ private:
+  const char* names_[MaxProbes] = {};
+  size_t name_sizes_[MaxProbes] = {};
+  histogram histograms_[MaxProbes] = {};
+  size_t probe_count_ = 0;
+  clock_source source_ = clock_source::cycles;
+  uint64_t frequency_ = 0;
+};
+
+//-------------------------------------------------------------------------------------------------
+// Dump implementation
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+/// Bounds-checked output: every write reserves the maximum size of a varint
+class dump_writer {
+ public:
+  dump_writer(unsigned char* out, size_t capacity) : out_(out), end_(out + capacity), ok_(true) {}
+
+  template <typename T>
+  void varint(T value) {
+    if (ok_ && static_cast<size_t>(end_ - out_) >= varint_max_size<T>()) out_ = varint_encode(value, out_);
+    else ok_ = false;
+  }
+
+  void byte(uint8_t value) { bytes(reinterpret_cast<const char*>(&value), 1); }
+
+  void bytes(const char* data, size_t size) {
+    if (!ok_ || static_cast<size_t>(end_ - out_) < size) {
+      ok_ = false;
+      return;
+    }
+    for (size_t i = 0; i < size; i++) *out_++ = static_cast<unsigned char>(data[i]);
+  }
+
+  bool ok() const { return ok_; }
+  unsigned char* position() const { return out_; }
+
+ private:
+  unsigned char* out_;
+  unsigned char* end_;
+  bool ok_;
+};
+
+inline size_t trace_name_size(const char* name) {
+  size_t size = 0;
+  while (name[size] != '\0') size++;
+  return size;
+}
+
+}  // namespace detail
+
+#ifdef JTC_TRACE
+
+inline size_t dump(unsigned char* buffer, size_t capacity) {
+  const ring& events = this_thread_ring();
+
+  // Distinct probes, in order of first appearance. Dumps are rare, so a linear search is enough.
+  const probe_info* probes[JTC_TRACE_MAX_PROBES];
+  size_t probe_count = 0;
+  for (size_t i = 0; i < events.size(); i++) {
+    size_t p = 0;
+    while (p < probe_count && probes[p] != events[i].probe) p++;
+    if (p == probe_count && probe_count < JTC_TRACE_MAX_PROBES) probes[probe_count++] = events[i].probe;
+  }
+
+  detail::dump_writer out(buffer, capacity);
+  out.bytes("JTCT", 4);
+  out.byte(format_version());
+  out.byte(static_cast<uint8_t>(source()));
+  out.varint(frequency());
+
+  out.varint(static_cast<uint64_t>(probe_count));
+  for (size_t p = 0; p < probe_count; p++) {
+    const size_t size = detail::trace_name_size(probes[p]->name);
+    out.varint(static_cast<uint64_t>(size));
+    out.bytes(probes[p]->name, size);
+  }
+
+  size_t recorded = 0;
+  for (size_t i = 0; i < events.size(); i++) {
+    for (size_t p = 0; p < probe_count; p++) recorded += probes[p] == events[i].probe ? 1 : 0;
+  }
+  out.varint(static_cast<uint64_t>(recorded));
+
+  uint64_t previous = events.size() > 0 ? events[0].start : 0;
+  for (size_t i = 0; i < events.size(); i++) {
+    size_t p = 0;
+    while (p < probe_count && probes[p] != events[i].probe) p++;
+    if (p == probe_count) continue;
+    out.varint(static_cast<uint64_t>(p));
+    out.varint(static_cast<int64_t>(events[i].start - previous));
+    out.varint(events[i].duration);
+    previous = events[i].start;
+  }
+
+  return out.ok() ? static_cast<size_t>(out.position() - buffer) : 0;
+}
+
+#endif  // JTC_TRACE
+
+}  // namespace trace
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+struct trace_tests {
+  static_assert(jtc::trace::histogram_bucket(0) == 0, "JTC test failed!");
+  static_assert(jtc::trace::histogram_bucket(1) == 1, "JTC test failed!");
+  static_assert(jtc::trace::histogram_bucket(1000) == 10, "JTC test failed!");
+  static_assert(jtc::trace::histogram_bucket(~jtc::uint64_t(0)) == 64, "JTC test failed!");
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
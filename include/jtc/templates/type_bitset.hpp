@@ -0,0 +1,288 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// type_bitset.hpp: Sets of types from a closed type_list, as compile-time generated bitmasks
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_TYPE_BITSET_HPP
+#define JTC_TEMPLATES_TYPE_BITSET_HPP
+
+#include "conditional.hpp"
+#include "integer_sequence.hpp"
+#include "integer_width.hpp"
+#include "std_def.hpp"
+#include "std_int.hpp"
+#include "type_id.hpp"
+#include "type_list.hpp"
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// type_bitset definition
+//
+// A set of types from List, where the bit type_id_v<List, T>() indicates whether T is in the set.
+// The storage is a single word of the smallest fixed-width type holding List::size bits, or an array
+//   of uint64_t for lists of more than 64 types. Set operations are one bitwise operation per word.
+//
+// type_mask<List, Types...>::value is the set of Types, computed at compile time.
+//   type_mask<List, Types...>::types is the set as a type_list, in List order.
+// type_bitset_list_t<List, Mask> converts any compile-time set back to a type_list: Mask is a type
+//   with a constexpr static type_bitset 'value', like type_mask.
+//
+// Usage:
+//     using messages = type_list<ping, pong, data, config>;
+//     constexpr auto supported = type_mask<messages, ping, data>::value;
+//     if (supported.contains(received_tag)) { ... }                      // A single AND
+//     auto common = supported & type_mask<messages, data, config>::value;  // {data}
+//-------------------------------------------------------------------------------------------------
+
+// Forward declaration of the implementation
+namespace detail {
+template <typename List, bool Single = (List::size <= 64)> struct type_bitset_storage;
+template <typename Word> constexpr size_t popcount(Word word);
+}  // namespace detail
+
+template <typename List>
+class type_bitset {
+  using storage = detail::type_bitset_storage<List>;
+  using indexes = make_index_sequence<storage::word_count>;
+
+ public:
+  /// Type of each word of the mask
+  using word_type = typename storage::word_type;
+
+  /// Number of words of the mask
+  constexpr static size_t word_count = storage::word_count;
+
+  /// Number of bits per word
+  constexpr static size_t word_bits = sizeof(word_type) * 8;
+
+  /// Empty set
+  constexpr type_bitset() : type_bitset(from_ids{}, indexes{}) {}
+
+  /// The set of Types
+  template <typename... Types>
+  constexpr static type_bitset of() { return type_bitset(from_ids{}, indexes{}, type_id_v<List, Types>()...); }
+
+  /// The set of all types in List
+  constexpr static type_bitset all() { return ~type_bitset(); }
+
+  /// Whether the type with ID id is in the set
+  constexpr bool test(size_t id) const { return ((words_[id / word_bits] >> (id % word_bits)) & 1) != 0; }
+
+  /// Whether T is in the set
+  template <typename T>
+  constexpr bool contains() const { return test(type_id_v<List, T>()); }
+
+  /// Whether the tagged type is in the set
+  constexpr bool contains(type_tag<List> tag) const { return test(tag.id()); }
+
+  /// Whether all types of other are in the set
+  constexpr bool contains_all(const type_bitset& other) const { return (*this & other) == other; }
+
+  /// Whether any type of other is in the set
+  constexpr bool contains_any(const type_bitset& other) const { return !(*this & other).empty(); }
+
+  /// Whether the set is empty
+  constexpr bool empty() const { return *this == type_bitset(); }
+
+  /// Number of types in the set
+  constexpr size_t count() const { return count(0); }
+
+  /// Word i of the mask
+  constexpr word_type word(size_t i) const { return words_[i]; }
+
+  /// Adds or removes a type
+  template <typename T> void insert() { set(type_id_v<List, T>(), true); }
+  template <typename T> void erase() { set(type_id_v<List, T>(), false); }
+
+  void set(size_t id, bool value) {
+    const word_type bit = static_cast<word_type>(word_type(1) << (id % word_bits));
+    words_[id / word_bits] = static_cast<word_type>(value ? words_[id / word_bits] | bit : words_[id / word_bits] & ~bit);
+  }
+
+  /// Union, intersection, difference and complement
+  friend constexpr type_bitset operator|(const type_bitset& a, const type_bitset& b) { return a.apply(b, op_or{}, indexes{}); }
+  friend constexpr type_bitset operator&(const type_bitset& a, const type_bitset& b) { return a.apply(b, op_and{}, indexes{}); }
+  friend constexpr type_bitset operator-(const type_bitset& a, const type_bitset& b) { return a.apply(b, op_and_not{}, indexes{}); }
+  friend constexpr type_bitset operator^(const type_bitset& a, const type_bitset& b) { return a.apply(b, op_xor{}, indexes{}); }
+  constexpr type_bitset operator~() const { return complement(indexes{}); }
+
+  type_bitset& operator|=(const type_bitset& other) { return *this = *this | other; }
+  type_bitset& operator&=(const type_bitset& other) { return *this = *this & other; }
+  type_bitset& operator-=(const type_bitset& other) { return *this = *this - other; }
+  type_bitset& operator^=(const type_bitset& other) { return *this = *this ^ other; }
+
+  friend constexpr bool operator==(const type_bitset& a, const type_bitset& b) { return a.equals(b, 0); }
+  friend constexpr bool operator!=(const type_bitset& a, const type_bitset& b) { return !(a == b); }
+
+ private:
+  struct op_or      { constexpr word_type operator()(word_type a, word_type b) const { return a | b; } };
+  struct op_and     { constexpr word_type operator()(word_type a, word_type b) const { return a & b; } };
+  struct op_and_not { constexpr word_type operator()(word_type a, word_type b) const { return a & ~b; } };
+  struct op_xor     { constexpr word_type operator()(word_type a, word_type b) const { return a ^ b; } };
+
+  /// Mask of the bits of word i that map to types in List
+  constexpr static word_type valid_bits(size_t i) {
+    return List::size >= (i + 1) * word_bits ? static_cast<word_type>(~word_type(0))
+                                              : static_cast<word_type>((word_type(1) << (List::size - i * word_bits)) - 1);
+  }
+
+  /// Word i of the set of the types with IDs ids
+  template <typename... Ids>
+  constexpr static word_type make_word(size_t i, Ids... ids) { return make_word_impl(i, word_type(0), ids...); }
+
+  constexpr static word_type make_word_impl(size_t, word_type word) { return word; }
+
+  template <typename Id, typename... Ids>
+  constexpr static word_type make_word_impl(size_t i, word_type word, Id id, Ids... ids) {
+    return make_word_impl(i, id / word_bits == i ? static_cast<word_type>(word | (word_type(1) << (id % word_bits))) : word,
+                          ids...);
+  }
+
+  /// Constructs the set of the types with IDs ids
+  struct from_ids {};
+  template <size_t... Is, typename... Ids>
+  constexpr type_bitset(from_ids, index_sequence<Is...>, Ids... ids) : words_{make_word(Is, ids...)...} {}
+
+  struct from_words {};
+  template <typename... Words>
+  constexpr type_bitset(from_words, Words... words) : words_{static_cast<word_type>(words)...} {}
+
+  template <typename Op, size_t... Is>
+  constexpr type_bitset apply(const type_bitset& other, Op op, index_sequence<Is...>) const {
+    return type_bitset(from_words{}, op(words_[Is], other.words_[Is])...);
+  }
+
+  template <size_t... Is>
+  constexpr type_bitset complement(index_sequence<Is...>) const {
+    return type_bitset(from_words{}, (~words_[Is] & valid_bits(Is))...);
+  }
+
+  constexpr bool equals(const type_bitset& other, size_t i) const {
+    return i == word_count || (words_[i] == other.words_[i] && equals(other, i + 1));
+  }
+
+  constexpr size_t count(size_t i) const { return i == word_count ? 0 : detail::popcount(words_[i]) + count(i + 1); }
+
+  word_type words_[word_count];
+};
+
+template <typename List>
+constexpr size_t type_bitset<List>::word_count;
+
+template <typename List>
+constexpr size_t type_bitset<List>::word_bits;
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time sets and conversion to type_list
+//-------------------------------------------------------------------------------------------------
+
+// Forward declaration of the implementation
+namespace detail { template <typename List, typename Mask, typename Indexes> struct type_bitset_filter; }
+
+/// Types of List in the set Mask::value, in List order
+template <typename List, typename Mask>
+using type_bitset_list_t = typename detail::type_bitset_filter<List, Mask, make_index_sequence<List::size>>::type;
+
+/// The set of Types, as a compile-time constant
+template <typename List, typename... Types>
+struct type_mask {
+  constexpr static type_bitset<List> value = type_bitset<List>::template of<Types...>();
+  using types = type_bitset_list_t<List, type_mask>;
+};
+
+template <typename List, typename... Types>
+constexpr type_bitset<List> type_mask<List, Types...>::value;
+
+//-------------------------------------------------------------------------------------------------
+// Implementation
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+/// Up to 64 types: a single word, as small as possible
+template <typename List>
+struct type_bitset_storage<List, true> {
+  using word_type = uint_least_t<(List::size > 0 ? List::size : 1)>;
+  constexpr static size_t word_count = 1;
+};
+
+/// More than 64 types: an array of 64-bit words
+template <typename List>
+struct type_bitset_storage<List, false> {
+  using word_type = uint64_t;
+  constexpr static size_t word_count = (List::size + 63) / 64;
+};
+
+#if defined(__GNUC__) || defined(__clang__)
+template <typename Word>
+constexpr size_t popcount(Word word) { return static_cast<size_t>(__builtin_popcountll(word)); }
+#else
+template <typename Word>
+constexpr size_t popcount(Word word) { return word == 0 ? 0 : 1 + popcount(static_cast<Word>(word & (word - 1))); }
+#endif
+
+template <typename... Types, typename Mask, size_t... Is>
+struct type_bitset_filter<type_list<Types...>, Mask, index_sequence<Is...>>
+    : list_concat<type_list<>, conditional_t<Mask::value.test(Is), type_list<Types>, type_list<>>...> {};
+
+}  // namespace detail
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+namespace type_bitset_helpers {
+using list = jtc::type_list<char, short, int, long, float, double>;
+
+template <size_t N> struct many {};
+template <typename> struct many_list;
+template <size_t... Ns> struct many_list<jtc::index_sequence<Ns...>> : jtc::make_type<jtc::type_list<many<Ns>...>> {};
+using list_300 = typename many_list<jtc::make_index_sequence<300>>::type;
+}  // namespace type_bitset_helpers
+
+struct type_bitset_tests {
+  using list = type_bitset_helpers::list;
+  using big = type_bitset_helpers::list_300;
+  using ints = jtc::type_mask<list, char, short, int, long>;
+  using wide = jtc::type_mask<list, int, long, double>;
+
+  // Storage selection
+  static_assert(jtc::is_same_v<jtc::type_bitset<list>::word_type, jtc::uint8_t>(), "JTC test failed!");
+  static_assert(sizeof(jtc::type_bitset<list>) == 1, "JTC test failed!");
+  static_assert(jtc::type_bitset<big>::word_count == 5, "JTC test failed!");
+
+  // Membership and set operations
+  static_assert(ints::value.contains<short>() && !ints::value.contains<float>(), "JTC test failed!");
+  static_assert(ints::value.word(0) == 0x0F, "JTC test failed!");
+  static_assert((ints::value & wide::value) == jtc::type_mask<list, int, long>::value, "JTC test failed!");
+  static_assert((ints::value | wide::value).count() == 5, "JTC test failed!");
+  static_assert((ints::value - wide::value).count() == 2, "JTC test failed!");
+  static_assert((~ints::value).word(0) == 0x30, "JTC test failed!");
+  static_assert(jtc::type_bitset<list>::all().count() == 6, "JTC test failed!");
+  static_assert(ints::value.contains_any(wide::value) && !ints::value.contains_all(wide::value), "JTC test failed!");
+  static_assert(jtc::type_bitset<list>().empty(), "JTC test failed!");
+
+  // Multiple words
+  static_assert(jtc::type_mask<big, type_bitset_helpers::many<299>>::value.word(4) == (jtc::uint64_t(1) << 43), "JTC test failed!");
+  static_assert((~jtc::type_bitset<big>()).count() == 300, "JTC test failed!");
+
+  // Conversion to type_list
+  static_assert(jtc::is_same_v<jtc::type_mask<list, double, char>::types, jtc::type_list<char, double>>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::type_mask<list>::types, jtc::type_list<>>(), "JTC test failed!");
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
@@ -0,0 +1,268 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// type_id.hpp: RTTI-free compact type identifiers, from the index of a type in a closed type_list
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_TYPE_ID_HPP
+#define JTC_TEMPLATES_TYPE_ID_HPP
+
+#include "integer_sequence.hpp"
+#include "integer_width.hpp"
+#include "integral_constant.hpp"
+#include "lookup_table.hpp"
+#include "span.hpp"
+#include "std_def.hpp"
+#include "type_list.hpp"
+
+// Compiler-specific function signature, used to extract type names at compile time
+#if defined(__clang__) || defined(__GNUC__)
+#define JTC_TYPE_SIGNATURE __PRETTY_FUNCTION__
+#elif defined(_MSC_VER)
+#define JTC_TYPE_SIGNATURE __FUNCSIG__
+#endif
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// Type names
+//
+// type_name<T>() is a view of T's name, as spelled by the compiler, extracted at compile time from
+//   the signature of a function template. It's meant for logs and debugging: the spelling is not
+//   portable across compilers. Without a known compiler, the name is empty.
+//
+// Usage:
+//     constexpr span<const char> name = type_name<int>();  // "int"
+//-------------------------------------------------------------------------------------------------
+
+// Forward declaration of the implementation
+namespace detail { template <typename T> constexpr span<const char> type_signature(); }
+
+template <typename T>
+constexpr span<const char> type_name();
+
+//-------------------------------------------------------------------------------------------------
+// Type IDs
+//
+// type_id<List, T> is the index of T in List. It's stored in type_id_t<List>, the smallest unsigned
+//   fixed-width type holding every index of List, so lists of up to 256 types have 1-byte IDs.
+// Querying a type that's not in List is a compile-time error.
+//
+// type_tag<List> is a runtime value holding a type_id, which can be compared, serialized and
+//   mapped back to the type's properties with type_tag::info().
+//
+// Usage:
+//     using messages = type_list<ping, pong, data>;
+//     static_assert(type_id_v<messages, pong>() == 1, "pong should have ID 1");
+//     type_tag<messages> tag = type_tag<messages>::of<data>();  // sizeof(tag) == 1
+//     if (tag.is<data>()) { ... }
+//     size_t size = tag.info().size;                              // sizeof(data)
+//-------------------------------------------------------------------------------------------------
+
+// Forward declaration of the implementation
+namespace detail {
+constexpr size_t type_id_bits(size_t max_index);
+template <typename List> struct type_id_storage;
+template <typename List, typename T> struct type_id_check;
+}  // namespace detail
+
+/// Storage type of the IDs of List
+template <typename List>
+using type_id_t = typename detail::type_id_storage<List>::type;
+
+/// The ID of T in List
+template <typename List, typename T>
+struct type_id : integral_constant<type_id_t<List>, detail::type_id_check<List, T>::value> {};
+
+template <typename List, typename T>
+inline constexpr type_id_t<List> type_id_v() { return type_id<List, T>::value; }
+
+//-------------------------------------------------------------------------------------------------
+// Reverse table: properties of the type with a given ID
+//-------------------------------------------------------------------------------------------------
+
+/// Properties of a type, available at runtime
+struct type_info_entry {
+  size_t size;
+  size_t alignment;
+  span<const char> name;
+};
+
+// Forward declaration of the implementation
+namespace detail {
+template <typename... Types>
+constexpr lookup_table<type_info_entry, sizeof...(Types)> make_type_info_table(type_list<Types...>);
+}
+
+/// Table of type_info_entry for each type in List, indexed by type ID
+template <typename List>
+struct type_info_table {
+  constexpr static lookup_table<type_info_entry, List::size> value = detail::make_type_info_table(List{});
+};
+
+template <typename List>
+constexpr lookup_table<type_info_entry, List::size> type_info_table<List>::value;
+
+//-------------------------------------------------------------------------------------------------
+// type_tag definition
+//-------------------------------------------------------------------------------------------------
+
+template <typename List>
+class type_tag {
+ public:
+  /// Storage type of the ID
+  using value_type = type_id_t<List>;
+
+  /// Tag of the type T
+  template <typename T>
+  constexpr static type_tag of() { return type_tag(type_id_v<List, T>()); }
+
+  /// Tag from a raw ID, e.g. a deserialized one. The ID must be valid (see is_valid).
+  constexpr static type_tag from_id(value_type id) { return type_tag(id); }
+
+  /// Whether id is the ID of a type in List
+  constexpr static bool is_valid(value_type id) { return id < List::size; }
+
+  /// The ID
+  constexpr value_type id() const { return id_; }
+
+  /// Whether this is the tag of T
+  template <typename T>
+  constexpr bool is() const { return id_ == type_id_v<List, T>(); }
+
+  /// sizeof, alignof and name of the tagged type
+  constexpr const type_info_entry& info() const { return type_info_table<List>::value[id_]; }
+
+  friend constexpr bool operator==(type_tag a, type_tag b) { return a.id_ == b.id_; }
+  friend constexpr bool operator!=(type_tag a, type_tag b) { return a.id_ != b.id_; }
+
+ private:
+  constexpr explicit type_tag(value_type id) : id_(id) {}
+
+  value_type id_;
+};
+
+//-------------------------------------------------------------------------------------------------
+// Implementation
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+/// Number of bits of max_index, at least 1
+constexpr size_t type_id_bits(size_t max_index) { return max_index <= 1 ? 1 : 1 + type_id_bits(max_index >> 1); }
+
+/// Checked first, as the largest index of an empty list, List::size - 1, would wrap around
+template <typename List>
+struct type_id_storage : make_type<uint_least_t<type_id_bits(List::size == 0 ? 0 : List::size - 1)>> {
+  static_assert(List::size > 0, "type_id requires a non-empty type_list.");
+};
+
+template <typename List, typename T>
+struct type_id_check : integral_constant<size_t, list_index_of_v<List, T>()> {
+  static_assert(list_has_type<List, T>(), "Type not found in the type_id list.");
+};
+
+#ifdef JTC_TYPE_SIGNATURE
+
+/// Signature of this function, including the name of T
+template <typename T>
+constexpr span<const char> type_signature() {
+  return span<const char>(JTC_TYPE_SIGNATURE, sizeof(JTC_TYPE_SIGNATURE) - 1);
+}
+
+// The name is located from a probe type, "int": the text around the name is the same for any T.
+using type_signature_probe = int;
+
+/// Whether the probe's name ends suffix characters before the end of its signature
+constexpr bool type_signature_probe_at(span<const char> s, size_t suffix) {
+  return s[s.size() - suffix - 3] == 'i' && s[s.size() - suffix - 2] == 'n' && s[s.size() - suffix - 1] == 't';
+}
+
+/// Length of the text after the name
+constexpr size_t type_signature_suffix(span<const char> s, size_t suffix = 0) {
+  return type_signature_probe_at(s, suffix) ? suffix : type_signature_suffix(s, suffix + 1);
+}
+
+constexpr size_t type_name_suffix() { return type_signature_suffix(type_signature<type_signature_probe>()); }
+constexpr size_t type_name_prefix() { return type_signature<type_signature_probe>().size() - type_name_suffix() - 3; }
+
+template <typename T>
+constexpr span<const char> type_name_impl() {
+  return type_signature<T>().subspan(type_name_prefix(),
+                                     type_signature<T>().size() - type_name_prefix() - type_name_suffix());
+}
+
+#else
+
+template <typename T>
+constexpr span<const char> type_name_impl() { return span<const char>(); }
+
+#endif  // JTC_TYPE_SIGNATURE
+
+template <typename... Types>
+constexpr lookup_table<type_info_entry, sizeof...(Types)> make_type_info_table(type_list<Types...>) {
+  return lookup_table<type_info_entry, sizeof...(Types)>{{type_info_entry{sizeof(Types), alignof(Types), type_name<Types>()}...}};
+}
+
+}  // namespace detail
+
+template <typename T>
+constexpr span<const char> type_name() {
+  return detail::type_name_impl<T>();
+}
+
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+namespace type_id_helpers {
+using list = jtc::type_list<char, short, int, double>;
+
+template <size_t N> struct many {};
+template <typename> struct many_list;
+template <size_t... Ns> struct many_list<jtc::index_sequence<Ns...>> : jtc::make_type<jtc::type_list<many<Ns>...>> {};
+using list_300 = typename many_list<jtc::make_index_sequence<300>>::type;
+
+constexpr bool equals(jtc::span<const char> s, const char* text, size_t i = 0) {
+  return i == s.size() ? text[i] == '\0' : s[i] == text[i] && equals(s, text, i + 1);
+}
+}  // namespace type_id_helpers
+
+struct type_id_tests {
+  using list = type_id_helpers::list;
+
+  // IDs
+  static_assert(jtc::type_id_v<list, char>() == 0, "JTC test failed!");
+  static_assert(jtc::type_id_v<list, double>() == 3, "JTC test failed!");
+  static_assert(jtc::type_tag<list>::of<int>().is<int>(), "JTC test failed!");
+  static_assert(jtc::type_tag<list>::of<int>() != jtc::type_tag<list>::of<short>(), "JTC test failed!");
+  static_assert(!jtc::type_tag<list>::is_valid(4), "JTC test failed!");
+
+  // Storage
+  static_assert(jtc::is_same_v<jtc::type_id_t<list>, jtc::uint8_t>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::type_id_t<type_id_helpers::list_300>, jtc::uint16_t>(), "JTC test failed!");
+  static_assert(sizeof(jtc::type_tag<list>) == 1, "JTC test failed!");
+
+  // Reverse table
+  static_assert(jtc::type_tag<list>::from_id(1).info().size == sizeof(short), "JTC test failed!");
+  static_assert(jtc::type_tag<list>::of<double>().info().alignment == alignof(double), "JTC test failed!");
+#ifdef JTC_TYPE_SIGNATURE
+  static_assert(type_id_helpers::equals(jtc::type_name<int>(), "int"), "JTC test failed!");
+  static_assert(type_id_helpers::equals(jtc::type_tag<list>::of<double>().info().name, "double"), "JTC test failed!");
+#endif
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
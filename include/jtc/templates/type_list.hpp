@@ -9,6 +9,7 @@
 #define JTC_TEMPLATES_TYPE_LIST_HPP
 
 #include "conditional.hpp"
+#include "integral_constant.hpp"
 #include "is_same.hpp"
 #include "make_type.hpp"
 #include "result_type.hpp"
@@ -85,6 +86,29 @@ using list_find_t = typename list_find<List, Query>::type;
 template <typename List, typename Query>
 inline constexpr bool list_has_type() { return list_find<List, Query>::value; }
 
+//-------------------------------------------------------------------------------------------------
+// Item Index
+//
+// Index of the first node where is_same_v<Node, Query>() == true, or List::size if there's none.
+//
+// Usage:
+//     using my_list = type_list<char, short, int>;
+//     static_assert(list_index_of_v<my_list, int>() == 2, "'int' should be at index 2");
+//-------------------------------------------------------------------------------------------------
+
+template <typename List, typename Query>
+struct list_index_of;
+
+template <typename List, typename Query>
+inline constexpr size_t list_index_of_v() { return list_index_of<List, Query>::value; }
+
+template <typename Node, typename... Nodes, typename Query>
+struct list_index_of<type_list<Node, Nodes...>, Query>
+    : integral_constant<size_t, is_same_v<Node, Query>() ? 0 : 1 + list_index_of_v<type_list<Nodes...>, Query>()> {};
+
+template <typename Query>
+struct list_index_of<type_list<>, Query> : integral_constant<size_t, 0> {};
+
 //-------------------------------------------------------------------------------------------------
 // Item Search by Operator
 //
@@ -219,6 +243,25 @@ struct list_concat<type_list<NodesA...>, type_list<NodesB...>, Lists...>
 template <typename... Nodes>
 struct list_concat<type_list<Nodes...>> : make_type<type_list<Nodes...>> {};
 
+//-------------------------------------------------------------------------------------------------
+// Remove Duplicates
+//
+// Keeps the first occurrence of each type, in order.
+//
+// Usage:
+//     using unique = list_unique_t<type_list<int, char, int, float, char>>;
+//     (unique becomes type_list<int, char, float>)
+//-------------------------------------------------------------------------------------------------
+
+// Forward declaration of the implementation
+namespace detail { template <typename List, typename Node> struct push_unique; }
+
+template <typename List>
+struct list_unique : list_accumulate<List, detail::push_unique, type_list<>> {};
+
+template <typename List>
+using list_unique_t = typename list_unique<List>::type;
+
 //-------------------------------------------------------------------------------------------------
 // Implementation of List Search Algorithms, O(n), left-to-right linear search.
 //-------------------------------------------------------------------------------------------------
@@ -269,6 +312,13 @@ struct list_find_where_impl<type_list<Nodes...>, BoolOperator> : find_param_oper
 template <template <typename...> class BoolOperator>
 struct list_find_where_impl<type_list<>, BoolOperator> : result_type<false> {};
 
+//-------------------------------------------------------------------------------------------------
+// list_unique Implementation: accumulates the nodes that aren't in the result yet
+//-------------------------------------------------------------------------------------------------
+
+template <typename List, typename Node>
+struct push_unique : conditional<list_has_type<List, Node>(), List, list_concat_t<List, type_list<Node>>> {};
+
 }  // namespace detail
 }  // namespace jtc
 
@@ -276,16 +326,58 @@ struct list_find_where_impl<type_list<>, BoolOperator> : result_type<false> {};
 // Compile-time Tests
 //-------------------------------------------------------------------------------------------------
 
-#ifndef JTC_NO_TESTS
+#ifdef JTC_TESTS
 
 namespace jtc {
 namespace tests {
 
-// TODO
+namespace type_list_helpers {
+template <typename T> using add_pointer = jtc::make_type<T*>;
+template <typename T> using is_not_char = jtc::bool_constant<!jtc::is_same_v<T, char>()>;
+template <typename A, typename B> struct pair : jtc::make_type<pair<A, B>> {};
+}  // namespace type_list_helpers
+
+struct type_list_tests {
+  using list = jtc::type_list<char, short, int, short>;
+  template <typename A, typename B> using pair = type_list_helpers::pair<A, B>;
+
+  // Size and indexing
+  static_assert(list::size == 4 && jtc::type_list<>::size == 0, "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::list_get_t<list, 0>, char>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::list_get_t<list, 3>, short>(), "JTC test failed!");
+
+  // Search
+  static_assert(jtc::list_has_type<list, int>() && !jtc::list_has_type<list, long>(), "JTC test failed!");
+  static_assert(!jtc::list_has_type<jtc::type_list<>, int>(), "JTC test failed!");
+  static_assert(jtc::list_index_of_v<list, short>() == 1, "JTC test failed!");
+  static_assert(jtc::list_index_of_v<list, long>() == list::size, "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::list_find_where_t<list, type_list_helpers::is_not_char>, short>(), "JTC test failed!");
+  static_assert(!jtc::list_has_match<jtc::type_list<char, char>, type_list_helpers::is_not_char>(), "JTC test failed!");
+
+  // Transform and reductions
+  static_assert(jtc::is_same_v<jtc::list_transform_t<jtc::type_list<char, int>, type_list_helpers::add_pointer>,
+                               jtc::type_list<char*, int*>>(),
+                "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::list_accumulate_t<jtc::type_list<char, int>, type_list_helpers::pair, void>,
+                               pair<pair<void, char>, int>>(),
+                "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::list_reduce_t<jtc::type_list<char, short, int>, type_list_helpers::pair>,
+                               pair<pair<char, short>, int>>(),
+                "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::list_reduce_right_t<jtc::type_list<char, short, int>, type_list_helpers::pair>,
+                               pair<char, pair<short, int>>>(),
+                "JTC test failed!");
+
+  // Concatenation and duplicates
+  static_assert(jtc::is_same_v<jtc::list_concat_t<jtc::type_list<char>, jtc::type_list<>, jtc::type_list<int, short>>,
+                               jtc::type_list<char, int, short>>(),
+                "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::list_unique_t<list>, jtc::type_list<char, short, int>>(), "JTC test failed!");
+};
 
 }  // namespace tests
 }  // namespace jtc
 
-#endif  // JTC_NO_TESTS
+#endif  // JTC_TESTS
 
 #endif
\ No newline at end of file
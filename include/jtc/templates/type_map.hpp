@@ -122,16 +122,30 @@ struct map_search_impl<type_map<Nodes...>, Query> : search_iter<Query, Nodes...>
 // Compile-time Tests
 //-------------------------------------------------------------------------------------------------
 
-#ifndef JTC_NO_TESTS
+#ifdef JTC_TESTS
 
 namespace jtc {
 namespace tests {
 
-// TODO
+struct type_map_tests {
+  using map = jtc::type_map<jtc::map_node<char, unsigned char>, jtc::map_node<int, unsigned>, jtc::map_node<char, void>>;
+
+  // Queries
+  static_assert(map::size == 3, "JTC test failed!");
+  static_assert(jtc::map_has_key<map, int>() && !jtc::map_has_key<map, unsigned>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::map_get_t<map, int>, unsigned>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::map_get_t<map, char>, unsigned char>(), "JTC test failed!");  // First match
+
+  // Inversion
+  static_assert(jtc::is_same_v<jtc::invert_node_t<jtc::map_node<int, char>>, jtc::map_node<char, int>>(),
+                "JTC test failed!");
+  static_assert(jtc::is_same_v<jtc::map_get_t<jtc::map_invert_t<map>, unsigned>, int>(), "JTC test failed!");
+  static_assert(!jtc::map_has_key<jtc::map_invert_t<map>, int>(), "JTC test failed!");
+};
 
 }  // namespace tests
 }  // namespace jtc
 
-#endif  // JTC_NO_TESTS
+#endif  // JTC_TESTS
 
 #endif
\ No newline at end of file
@@ -0,0 +1,280 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// typed_storage.hpp: Heterogeneous storage of one value per key type, with compile-time lookup
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_TYPED_STORAGE_HPP
+#define JTC_TEMPLATES_TYPED_STORAGE_HPP
+
+#include "construct.hpp"
+#include "integral_constant.hpp"
+#include "is_same.hpp"
+#include "make_type.hpp"
+#include "move_forward.hpp"
+#include "std_def.hpp"
+#include "type_map.hpp"
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// typed_storage definition
+//
+// typed_storage<Entries...> holds exactly one value per key, in a single flat object.
+// Each entry is one of:
+//   - T: the key T, holding a T;
+//   - map_node<Key, T>: the key Key, holding a T (e.g. an interface mapped to its implementation);
+//   - lazy<T> or map_node<Key, lazy<T>>: same as above, but the value is only constructed on its
+//     first access, or by emplace. Unused lazy values cost no construction time.
+//
+// get<Key>() is resolved at compile time to a base class at a fixed offset: there's no runtime
+//   lookup. Lazy values add a single "constructed" flag check to each access.
+//
+// Usage:
+//     typed_storage<clock, map_node<logger, uart_logger>, lazy<radio>> services;
+//     services.get<logger>().write("boot");  // uart_logger&
+//     services.get<radio>().enable();         // radio is constructed here
+//-------------------------------------------------------------------------------------------------
+
+/// Marks an entry of typed_storage as lazily constructed
+template <typename T>
+struct lazy : make_type<T> {};
+
+// Forward declaration of the implementation
+namespace detail {
+template <typename Entry> struct typed_storage_node;
+template <typename Key, typename Slot> struct typed_storage_leaf;
+template <typename Key, typename... Keys> struct typed_storage_key_count;
+template <typename... Keys> struct typed_storage_unique_keys;
+}  // namespace detail
+
+template <typename... Entries>
+class typed_storage : detail::typed_storage_leaf<typename detail::typed_storage_node<Entries>::key_type,
+                                                 typename detail::typed_storage_node<Entries>::type>... {
+  /// Map of each key to its slot type
+  using map = type_map<typename detail::typed_storage_node<Entries>::node...>;
+
+  template <typename Key>
+  using leaf = detail::typed_storage_leaf<Key, map_get_t<map, Key>>;
+
+  template <typename Key>
+  struct check_key {
+    static_assert(map_has_key<map, Key>(), "Key not found in typed_storage.");
+    using type = Key;
+  };
+
+ public:
+  /// Type of the value stored for Key
+  template <typename Key>
+  using value_t = typename map_get_t<map, typename check_key<Key>::type>::value_type;
+
+  /// Number of stored values
+  constexpr static size_t size() { return sizeof...(Entries); }
+
+  /// Whether Key has a value in this storage
+  template <typename Key>
+  constexpr static bool contains() { return map_has_key<map, Key>(); }
+
+  /// Whether the value of Key is constructed lazily
+  template <typename Key>
+  constexpr static bool is_lazy() { return map_get_t<map, typename check_key<Key>::type>::is_lazy; }
+
+  /// Value of Key. Lazy values are default-constructed on the first access.
+  template <typename Key>
+  value_t<Key>& get() { return static_cast<leaf<Key>&>(*this).get(); }
+
+  template <typename Key>
+  const value_t<Key>& get() const { return static_cast<const leaf<Key>&>(*this).get(); }
+
+  /// Replaces the value of Key with one constructed from args
+  template <typename Key, typename... Args>
+  value_t<Key>& emplace(Args&&... args) {
+    return static_cast<leaf<Key>&>(*this).emplace(jtc::forward<Args>(args)...);
+  }
+
+  /// Whether the value of Key is constructed. Always true for non-lazy values.
+  template <typename Key>
+  bool has_value() const { return static_cast<const leaf<Key>&>(*this).has_value(); }
+
+  /// Destroys the value of a lazy Key, if constructed. It's constructed again on the next access.
+  template <typename Key>
+  void reset() {
+    static_assert(is_lazy<Key>(), "Only lazy values can be reset.");
+    static_cast<leaf<Key>&>(*this).reset();
+  }
+
+ private:
+  static_assert(sizeof...(Entries) > 0, "typed_storage requires at least one entry.");
+  static_assert(detail::typed_storage_unique_keys<typename detail::typed_storage_node<Entries>::key_type...>::value,
+                "Duplicate key in typed_storage.");
+};
+
+//-------------------------------------------------------------------------------------------------
+// Slots: the storage of a single value
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+/// Constructed with the storage, as a plain member
+template <typename T>
+struct typed_storage_slot {
+  using value_type = T;
+  constexpr static bool is_lazy = false;
+
+  /// Value-initialized: scalars start at zero
+  typed_storage_slot() : value() {}
+
+  T value;
+
+  T& get() { return value; }
+  const T& get() const { return value; }
+  bool has_value() const { return true; }
+
+  /// The replacement is constructed before the value is destroyed: if its constructor throws, the value is
+  ///   kept, and the arguments may refer to the value itself
+  template <typename... Args>
+  T& emplace(Args&&... args) {
+    T replacement(jtc::forward<Args>(args)...);
+    jtc::destroy_at(&value);
+    return *jtc::construct_at(&value, jtc::move(replacement));
+  }
+};
+
+/// Constructed on first access, in an aligned buffer.
+/// The buffer is mutable, so the first access may be through a const storage.
+template <typename T>
+class typed_storage_lazy_slot {
+ public:
+  using value_type = T;
+  constexpr static bool is_lazy = true;
+
+  typed_storage_lazy_slot() : constructed_(false) {}
+  typed_storage_lazy_slot(const typed_storage_lazy_slot& other) : constructed_(false) {
+    if (other.constructed_) emplace(*other.pointer());
+  }
+  typed_storage_lazy_slot& operator=(const typed_storage_lazy_slot& other) {
+    if (this != &other) {
+      reset();
+      if (other.constructed_) emplace(*other.pointer());
+    }
+    return *this;
+  }
+  ~typed_storage_lazy_slot() { reset(); }
+
+  T& get() const {
+    if (!constructed_) emplace();
+    return *pointer();
+  }
+
+  bool has_value() const { return constructed_; }
+
+  /// The flag is cleared before constructing: if the constructor throws, the slot is left empty
+  template <typename... Args>
+  T& emplace(Args&&... args) const {
+    reset();
+    jtc::construct_at(pointer(), jtc::forward<Args>(args)...);
+    constructed_ = true;
+    return *pointer();
+  }
+
+  void reset() const {
+    if (constructed_) jtc::destroy_at(pointer());
+    constructed_ = false;
+  }
+
+ private:
+  T* pointer() const { return reinterpret_cast<T*>(bytes_); }
+
+  alignas(T) mutable unsigned char bytes_[sizeof(T)];
+  mutable bool constructed_;
+};
+
+//-------------------------------------------------------------------------------------------------
+// Entry normalization: each entry becomes map_node<Key, Slot>
+//-------------------------------------------------------------------------------------------------
+
+template <typename Key, typename Slot>
+struct typed_storage_node_base {
+  using key_type = Key;
+  using type = Slot;
+  using node = map_node<Key, Slot>;
+};
+
+template <typename Entry>
+struct typed_storage_node : typed_storage_node_base<Entry, typed_storage_slot<Entry>> {};
+
+template <typename T>
+struct typed_storage_node<lazy<T>> : typed_storage_node_base<T, typed_storage_lazy_slot<T>> {};
+
+template <typename Key, typename T>
+struct typed_storage_node<map_node<Key, T>> : typed_storage_node_base<Key, typed_storage_slot<T>> {};
+
+template <typename Key, typename T>
+struct typed_storage_node<map_node<Key, lazy<T>>> : typed_storage_node_base<Key, typed_storage_lazy_slot<T>> {};
+
+/// A base class of typed_storage per key. The key disambiguates keys holding the same type.
+template <typename Key, typename Slot>
+struct typed_storage_leaf : Slot {};
+
+/// Number of occurrences of Key in Keys
+template <typename Key, typename... Keys>
+struct typed_storage_key_count : integral_constant<size_t, 0> {};
+
+template <typename Key, typename First, typename... Keys>
+struct typed_storage_key_count<Key, First, Keys...>
+    : integral_constant<size_t, (is_same_v<Key, First>() ? 1 : 0) + typed_storage_key_count<Key, Keys...>::value> {};
+
+/// Whether each key occurs once
+constexpr bool typed_storage_all_once() { return true; }
+
+template <typename... Counts>
+constexpr bool typed_storage_all_once(size_t count, Counts... counts) {
+  return count == 1 && typed_storage_all_once(counts...);
+}
+
+template <typename... Keys>
+struct typed_storage_unique_keys
+    : bool_constant<typed_storage_all_once(typed_storage_key_count<Keys, Keys...>::value...)> {};
+
+}  // namespace detail
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+namespace typed_storage_helpers {
+struct interface {};
+struct implementation : interface { int x; };
+using storage = jtc::typed_storage<int, jtc::map_node<interface, implementation>, jtc::lazy<double>>;
+}  // namespace typed_storage_helpers
+
+struct typed_storage_tests {
+  using storage = typed_storage_helpers::storage;
+  using interface = typed_storage_helpers::interface;
+  using implementation = typed_storage_helpers::implementation;
+
+  static_assert(storage::size() == 3, "JTC test failed!");
+  static_assert(storage::contains<interface>(), "JTC test failed!");
+  static_assert(!storage::contains<implementation>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<storage::value_t<interface>, implementation>(), "JTC test failed!");
+  static_assert(jtc::is_same_v<storage::value_t<double>, double>(), "JTC test failed!");
+  static_assert(!storage::is_lazy<int>(), "JTC test failed!");
+  static_assert(storage::is_lazy<double>(), "JTC test failed!");
+
+  // A single flat object: no pointers or lookup tables
+  static_assert(sizeof(jtc::typed_storage<int, char>) <= 2 * sizeof(int), "JTC test failed!");
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
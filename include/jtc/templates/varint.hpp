@@ -0,0 +1,247 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// varint.hpp: Unrolled varint (unsigned LEB128) and zigzag encoding kernels
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_VARINT_HPP
+#define JTC_TEMPLATES_VARINT_HPP
+
+#include "cv_ref_traits.hpp"
+#include "make_signed_unsigned.hpp"
+#include "number_traits.hpp"
+#include "std_def.hpp"
+#include "std_int.hpp"
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// Zigzag encoding
+//
+// Maps signed integers to unsigned ones, so values of small magnitude have small encodings:
+//   0 -> 0, -1 -> 1, 1 -> 2, -2 -> 3, ...
+//-------------------------------------------------------------------------------------------------
+
+template <typename T>
+constexpr make_unsigned_t<T> zigzag_encode(T value) {
+  static_assert(is_signed_v<T>() && is_integral_v<T>(), "zigzag_encode requires a signed integral type.");
+  return static_cast<make_unsigned_t<T>>((static_cast<make_unsigned_t<T>>(value) << 1) ^
+                                         static_cast<make_unsigned_t<T>>(value < 0 ? -1 : 0));
+}
+
+template <typename U>
+constexpr make_signed_t<U> zigzag_decode(U value) {
+  static_assert(is_unsigned_v<U>() && is_integral_v<U>(), "zigzag_decode requires an unsigned integral type.");
+  return static_cast<make_signed_t<U>>(static_cast<U>(value >> 1) ^ static_cast<U>(0 - static_cast<U>(value & 1)));
+}
+
+//-------------------------------------------------------------------------------------------------
+// Varint encoding
+//
+// Each byte holds 7 bits of the value, least significant first, and a continuation bit (0x80).
+// Unsigned types are encoded as unsigned LEB128 (the protobuf varint). Signed types are zigzag-encoded first.
+//
+// The maximum size of a type is known at compile time (varint_max_size), so encoding and decoding are
+//   fully unrolled, with at most that many steps.
+//
+// Decoding returns the position after the value, or nullptr when the input ends before the value,
+//   or the value is longer than varint_max_size<T>(). Bits beyond the width of T are discarded.
+//
+// Usage:
+//     unsigned char buffer[varint_max_size<uint32_t>() * 2];
+//     unsigned char* end = varint_encode(uint32_t(300), buffer);  // 2 bytes: 0xAC 0x02
+//     end = varint_encode(int16_t(-3), end);                      // 1 byte: 0x05
+//     uint32_t a; int16_t b;
+//     const unsigned char* p = varint_decode(buffer, end, a);
+//     p = varint_decode(p, end, b);
+//-------------------------------------------------------------------------------------------------
+
+/// Maximum encoded size of T, in bytes
+template <typename T>
+constexpr size_t varint_max_size() {
+  static_assert(is_integral_v<T>(), "varint requires an integral type.");
+  return (sizeof(T) * 8 + 6) / 7;
+}
+
+// Forward declaration of the implementation
+namespace detail {
+template <typename T, bool = is_signed_v<T>()> struct varint_traits;
+template <typename U, size_t I, size_t Max = varint_max_size<U>(), bool Last = (I + 1 == Max)> struct varint_codec;
+template <typename U> constexpr size_t varint_size_impl(U value, size_t size = 1);
+}  // namespace detail
+
+/// Encoded size of value, in bytes
+template <typename T>
+constexpr size_t varint_size(T value) {
+  return detail::varint_size_impl(detail::varint_traits<remove_cv_t<T>>::to_unsigned(value));
+}
+
+/// Writes value at out, returning the position after it. out must have varint_max_size<T>() bytes.
+template <typename T>
+inline unsigned char* varint_encode(T value, unsigned char* out) {
+  using traits = detail::varint_traits<remove_cv_t<T>>;
+  return detail::varint_codec<typename traits::unsigned_type, 0>::encode(traits::to_unsigned(value), out);
+}
+
+/// Reads a value from [in, end)
+template <typename T>
+inline const unsigned char* varint_decode(const unsigned char* in, const unsigned char* end, T& value) {
+  using traits = detail::varint_traits<T>;
+  typename traits::unsigned_type raw = 0;
+  const unsigned char* next = detail::varint_codec<typename traits::unsigned_type, 0>::decode(in, end, raw);
+  value = traits::from_unsigned(raw);
+  return next;
+}
+
+/// Reads a value from in, without bounds checks: in must have varint_max_size<T>() readable bytes
+template <typename T>
+inline const unsigned char* varint_decode_unchecked(const unsigned char* in, T& value) {
+  using traits = detail::varint_traits<T>;
+  typename traits::unsigned_type raw = 0;
+  const unsigned char* next = detail::varint_codec<typename traits::unsigned_type, 0>::decode(in, nullptr, raw);
+  value = traits::from_unsigned(raw);
+  return next;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Batch encoding and decoding
+//
+// varint_decode_n reads count values. Bounds are checked once for each run of values that fits the
+//   remaining input even at the maximum size: when the buffer is large enough for the whole batch,
+//   that's a single check. Only the values near the end of the input are decoded one by one.
+//-------------------------------------------------------------------------------------------------
+
+/// Writes count values, returning the position after them. out must have count * varint_max_size<T>() bytes.
+template <typename T>
+inline unsigned char* varint_encode_n(const T* values, size_t count, unsigned char* out) {
+  for (size_t i = 0; i < count; i++) out = varint_encode(values[i], out);
+  return out;
+}
+
+/// Reads count values from [in, end), returning the position after them, or nullptr on errors
+template <typename T>
+inline const unsigned char* varint_decode_n(const unsigned char* in, const unsigned char* end, T* values, size_t count) {
+  constexpr size_t max_size = varint_max_size<T>();
+  size_t i = 0;
+  while (i < count) {
+    // Values that fit in the remaining input, even if all of them have the maximum size
+    const size_t remaining = static_cast<size_t>(end - in) / max_size;
+    size_t safe = count - i < remaining ? count - i : remaining;
+    if (safe == 0) {
+      in = varint_decode(in, end, values[i++]);
+      if (in == nullptr) return nullptr;
+      continue;
+    }
+    for (; safe > 0; safe--) {
+      in = varint_decode_unchecked(in, values[i++]);
+      if (in == nullptr) return nullptr;
+    }
+  }
+  return in;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Implementation
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+template <typename T>
+struct varint_traits<T, false> {
+  using unsigned_type = T;
+  constexpr static T to_unsigned(T value) { return value; }
+  constexpr static T from_unsigned(T value) { return value; }
+};
+
+template <typename T>
+struct varint_traits<T, true> {
+  using unsigned_type = make_unsigned_t<T>;
+  constexpr static unsigned_type to_unsigned(T value) { return zigzag_encode(value); }
+  constexpr static T from_unsigned(unsigned_type value) { return zigzag_decode(value); }
+};
+
+template <typename U>
+constexpr size_t varint_size_impl(U value, size_t size) {
+  return value < 0x80 ? size : varint_size_impl(static_cast<U>(value >> 7), size + 1);
+}
+
+/// Step I of the codec: encodes or decodes the byte I.
+/// A null end pointer disables the bounds checks.
+template <typename U, size_t I, size_t Max>
+struct varint_codec<U, I, Max, false> {
+  static unsigned char* encode(U value, unsigned char* out) {
+    if (value < 0x80) {
+      out[I] = static_cast<unsigned char>(value);
+      return out + I + 1;
+    }
+    out[I] = static_cast<unsigned char>(value | 0x80);
+    return varint_codec<U, I + 1, Max>::encode(static_cast<U>(value >> 7), out);
+  }
+
+  static const unsigned char* decode(const unsigned char* in, const unsigned char* end, U& value) {
+    if (end != nullptr && in + I >= end) return nullptr;
+    const unsigned char byte = in[I];
+    value = static_cast<U>(value | (static_cast<U>(byte & 0x7F) << (7 * I)));
+    if ((byte & 0x80) == 0) return in + I + 1;
+    return varint_codec<U, I + 1, Max>::decode(in, end, value);
+  }
+};
+
+/// Last step: the remaining bits fit in this byte, and there's no continuation
+template <typename U, size_t I, size_t Max>
+struct varint_codec<U, I, Max, true> {
+  static unsigned char* encode(U value, unsigned char* out) {
+    out[I] = static_cast<unsigned char>(value);
+    return out + I + 1;
+  }
+
+  static const unsigned char* decode(const unsigned char* in, const unsigned char* end, U& value) {
+    if (end != nullptr && in + I >= end) return nullptr;
+    const unsigned char byte = in[I];
+    if ((byte & 0x80) != 0) return nullptr;
+    value = static_cast<U>(value | (static_cast<U>(byte) << (7 * I)));
+    return in + I + 1;
+  }
+};
+
+}  // namespace detail
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+struct varint_tests {
+  // Maximum sizes
+  static_assert(jtc::varint_max_size<jtc::uint8_t>() == 2, "JTC test failed!");
+  static_assert(jtc::varint_max_size<jtc::uint16_t>() == 3, "JTC test failed!");
+  static_assert(jtc::varint_max_size<jtc::int32_t>() == 5, "JTC test failed!");
+  static_assert(jtc::varint_max_size<jtc::uint64_t>() == 10, "JTC test failed!");
+
+  // Zigzag
+  static_assert(jtc::zigzag_encode(jtc::int32_t(0)) == 0, "JTC test failed!");
+  static_assert(jtc::zigzag_encode(jtc::int32_t(-1)) == 1, "JTC test failed!");
+  static_assert(jtc::zigzag_encode(jtc::int32_t(1)) == 2, "JTC test failed!");
+  static_assert(jtc::zigzag_encode(jtc::int8_t(-128)) == 255, "JTC test failed!");
+  static_assert(jtc::zigzag_decode(jtc::uint8_t(255)) == -128, "JTC test failed!");
+  static_assert(jtc::zigzag_decode(jtc::uint64_t(4)) == 2, "JTC test failed!");
+
+  // Encoded sizes
+  static_assert(jtc::varint_size(jtc::uint32_t(127)) == 1, "JTC test failed!");
+  static_assert(jtc::varint_size(jtc::uint32_t(300)) == 2, "JTC test failed!");
+  static_assert(jtc::varint_size(jtc::int32_t(-64)) == 1, "JTC test failed!");
+  static_assert(jtc::varint_size(~jtc::uint64_t(0)) == 10, "JTC test failed!");
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
@@ -0,0 +1,380 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// vec.hpp: Small fixed-size vectors, with expression templates that evaluate whole expressions in a single pass
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_VEC_HPP
+#define JTC_TEMPLATES_VEC_HPP
+
+#include "bool_operations.hpp"
+#include "conditional.hpp"
+#include "cv_ref_traits.hpp"
+#include "declval.hpp"
+#include "enable_if.hpp"
+#include "integer_sequence.hpp"
+#include "integral_constant.hpp"
+#include "is_same.hpp"
+#include "move_forward.hpp"
+#include "number_traits.hpp"
+#include "std_def.hpp"
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// vec and vector expressions
+//
+// vec<T, N> holds N values of T, for geometry and other small linear algebra.
+//
+// Arithmetic operators don't compute anything: they return an expression node, which stores its operands
+//   and computes a single element on request. The whole expression is evaluated when it's assigned to a vec,
+//   in one unrolled pass over the N elements, without a temporary vec for each operator.
+//   - Operands that are lvalues are stored by reference, so the expression doesn't copy them.
+//   - Operands that are rvalues (nested expressions, temporary vecs) are moved into the expression,
+//     so an expression kept in an 'auto' variable never refers to a destroyed temporary.
+//
+// All operations are element-wise, so a vec can appear on both sides of an assignment (e.g. a = b - a).
+// Scalars of the element type, or of arithmetic types that convert to it without narrowing (see is_widening),
+//   are broadcast to all elements. Other scalars must be converted explicitly: vec<int, 3>{1, 2, 3} * 2.5
+//   doesn't compile, instead of silently multiplying by 2.
+//
+// Usage:
+//     vec<float, 3> a{1, 2, 3}, b{...}, c{...};
+//     vec<float, 3> r = a * 2.0f + b - c;  // r[i] = a[i] * 2 + b[i] - c[i], with no intermediate vec
+//     float d = dot(r, a - b);
+//-------------------------------------------------------------------------------------------------
+
+template <typename T, size_t N>
+class vec;
+
+// Forward declarations of the implementation
+namespace detail {
+template <typename E> struct is_vec_expression;
+template <typename E> struct vec_assign;
+}  // namespace detail
+
+/// Whether E is a vec or a vector expression, ignoring cv-qualifiers and references
+template <typename E>
+inline constexpr bool is_vec_expression_v() { return detail::is_vec_expression<remove_cvref_t<E>>::value; }
+
+template <typename T, size_t N>
+class vec {
+  static_assert(N > 0, "vec requires at least one element.");
+  static_assert(!is_const_v<T>() && !is_volatile_v<T>(), "vec elements can't be cv-qualified.");
+
+ public:
+  /// Element type
+  using value_type = T;
+
+  /// Number of elements
+  constexpr static size_t size() { return N; }
+
+  /// Uninitialized, like the built-in types
+  vec() = default;
+
+  /// Initializes each element with one value
+  template <typename... Ts, typename = enable_if_t<sizeof...(Ts) == N && bool_and_v<bool_constant<
+                                                                               is_arithmetic_v<Ts>() || is_same_v<Ts, T>()>...>()>>
+  constexpr vec(Ts... values) : values_{static_cast<T>(values)...} {}
+
+  /// Evaluates a vector expression
+  template <typename E, typename = enable_if_t<is_vec_expression_v<E>() && !is_same_v<E, vec>()>>
+  constexpr vec(const E& expression) : vec(expression, make_index_sequence<N>{}) {}
+
+  /// Evaluates a vector expression into this vec
+  template <typename E, typename = enable_if_t<is_vec_expression_v<E>() && !is_same_v<E, vec>()>>
+  vec& operator=(const E& expression) {
+    detail::vec_assign<E>::apply(values_, expression, make_index_sequence<N>{});
+    return *this;
+  }
+
+  /// All elements initialized with value
+  constexpr static vec broadcast(T value) { return vec(value, make_index_sequence<N>{}); }
+
+  /// Element access
+  constexpr const T& operator[](size_t i) const { return values_[i]; }
+  T& operator[](size_t i) { return values_[i]; }
+
+  /// Pointer to the N contiguous elements
+  constexpr const T* data() const { return values_; }
+  T* data() { return values_; }
+
+  /// Compound assignment, from vector expressions or scalars
+  template <typename E> vec& operator+=(E&& other) { return *this = *this + jtc::forward<E>(other); }
+  template <typename E> vec& operator-=(E&& other) { return *this = *this - jtc::forward<E>(other); }
+  template <typename E> vec& operator*=(E&& other) { return *this = *this * jtc::forward<E>(other); }
+  template <typename E> vec& operator/=(E&& other) { return *this = *this / jtc::forward<E>(other); }
+
+ private:
+  template <typename E, size_t... Is>
+  constexpr vec(const E& expression, index_sequence<Is...>) : values_{static_cast<T>(expression[Is])...} {
+    static_assert(remove_cvref_t<E>::size() == N, "vec can't be initialized from an expression of a different size.");
+  }
+
+  template <size_t... Is>
+  constexpr vec(T value, index_sequence<Is...>) : values_{((void)Is, value)...} {}
+
+  T values_[N];
+};
+
+//-------------------------------------------------------------------------------------------------
+// Expression nodes
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+/// How an operand is stored in an expression: lvalues by const reference, rvalues by value
+template <typename A>
+using vec_operand_t = conditional_t<is_lvalue_reference_v<A>(), const remove_reference_t<A>&, remove_cvref_t<A>>;
+
+/// Element-wise operation over two expressions
+template <typename Op, typename L, typename R>
+struct vec_binary {
+  using value_type = typename remove_cvref_t<L>::value_type;
+  constexpr static size_t size() { return remove_cvref_t<L>::size(); }
+
+  L lhs;
+  R rhs;
+
+  constexpr value_type operator[](size_t i) const { return static_cast<value_type>(Op()(lhs[i], rhs[i])); }
+};
+
+/// Element-wise operation over one expression
+template <typename Op, typename A>
+struct vec_unary {
+  using value_type = typename remove_cvref_t<A>::value_type;
+  constexpr static size_t size() { return remove_cvref_t<A>::size(); }
+
+  A operand;
+
+  constexpr value_type operator[](size_t i) const { return static_cast<value_type>(Op()(operand[i])); }
+};
+
+/// A scalar, broadcast to N elements
+template <typename T, size_t N>
+struct vec_scalar {
+  using value_type = T;
+  constexpr static size_t size() { return N; }
+
+  T value;
+
+  constexpr T operator[](size_t) const { return value; }
+};
+
+template <typename E> struct is_vec_expression : false_type {};
+template <typename T, size_t N> struct is_vec_expression<vec<T, N>> : true_type {};
+template <typename Op, typename L, typename R> struct is_vec_expression<vec_binary<Op, L, R>> : true_type {};
+template <typename Op, typename A> struct is_vec_expression<vec_unary<Op, A>> : true_type {};
+template <typename T, size_t N> struct is_vec_expression<vec_scalar<T, N>> : true_type {};
+
+namespace vec_ops {
+struct plus       { template <typename U> constexpr auto operator()(const U& a, const U& b) const -> decltype(a + b) { return a + b; } };
+struct minus      { template <typename U> constexpr auto operator()(const U& a, const U& b) const -> decltype(a - b) { return a - b; } };
+struct multiplies { template <typename U> constexpr auto operator()(const U& a, const U& b) const -> decltype(a * b) { return a * b; } };
+struct divides    { template <typename U> constexpr auto operator()(const U& a, const U& b) const -> decltype(a / b) { return a / b; } };
+struct negate     { template <typename U> constexpr auto operator()(const U& a) const -> decltype(-a) { return -a; } };
+}  // namespace vec_ops
+
+/// A scalar operand is a value of the expression's element type, or of a type that widens to it
+template <typename S, typename E>
+struct is_vec_scalar_for
+    : bool_constant<!is_vec_expression_v<S>() &&
+                    is_widening_v<remove_cvref_t<S>, typename remove_cvref_t<E>::value_type>()> {};
+
+/// Result of a binary operator: defined only when one operand is an expression, and the other one
+///   is an expression of the same type and size, or a scalar.
+template <typename Op, typename A, typename B, bool = is_vec_expression_v<A>(), bool = is_vec_expression_v<B>()>
+struct vec_binary_result {};
+
+template <typename Op, typename A, typename B>
+struct vec_binary_result<Op, A, B, true, true> : make_type<vec_binary<Op, vec_operand_t<A>, vec_operand_t<B>>> {
+  static_assert(is_same_v<typename remove_cvref_t<A>::value_type, typename remove_cvref_t<B>::value_type>(),
+                "vec operands must have the same element type.");
+  static_assert(remove_cvref_t<A>::size() == remove_cvref_t<B>::size(), "vec operands must have the same size.");
+};
+
+template <typename Op, typename A, typename S>
+struct vec_binary_result<Op, A, S, true, false>
+    : enable_if<is_vec_scalar_for<S, A>::value,
+                vec_binary<Op, vec_operand_t<A>,
+                           vec_scalar<typename remove_cvref_t<A>::value_type, remove_cvref_t<A>::size()>>> {};
+
+template <typename Op, typename S, typename B>
+struct vec_binary_result<Op, S, B, false, true>
+    : enable_if<is_vec_scalar_for<S, B>::value,
+                vec_binary<Op, vec_scalar<typename remove_cvref_t<B>::value_type, remove_cvref_t<B>::size()>,
+                           vec_operand_t<B>>> {};
+
+template <typename Op, typename A, typename B>
+using vec_binary_result_t = typename vec_binary_result<Op, A, B>::type;
+
+// Node construction: operands are forwarded, so rvalues are moved into the node
+template <typename Node, typename A, typename B,
+          enable_if_t<is_vec_expression_v<A>() && is_vec_expression_v<B>(), int> = 0>
+constexpr Node vec_make(A&& a, B&& b) {
+  return Node{jtc::forward<A>(a), jtc::forward<B>(b)};
+}
+
+template <typename Node, typename A, typename S, enable_if_t<!is_vec_expression_v<S>(), int> = 0>
+constexpr Node vec_make(A&& a, S&& s) {
+  return Node{jtc::forward<A>(a), {static_cast<typename remove_cvref_t<A>::value_type>(s)}};
+}
+
+template <typename Node, typename S, typename B, enable_if_t<!is_vec_expression_v<S>(), int> = 0>
+constexpr Node vec_make(S&& s, B&& b) {
+  return Node{{static_cast<typename remove_cvref_t<B>::value_type>(s)}, jtc::forward<B>(b)};
+}
+
+/// Evaluation of an expression into an array, unrolled through an index sequence
+template <typename E>
+struct vec_assign {
+  template <typename T, size_t... Is>
+  static void apply(T* values, const E& expression, index_sequence<Is...>) {
+    // Element i only reads the operands' element i, so the expression may refer to the destination
+    using expand = int[];
+    (void)expand{0, (values[Is] = static_cast<T>(expression[Is]), 0)...};
+  }
+};
+
+/// Sum of the Count elements starting at Begin, as a balanced tree of additions
+template <typename E, size_t Begin>
+constexpr typename E::value_type vec_sum(const E& e, integral_constant<size_t, Begin>, integral_constant<size_t, 1>) {
+  return e[Begin];
+}
+
+template <typename E, size_t Begin, size_t Count>
+constexpr typename E::value_type vec_sum(const E& e, integral_constant<size_t, Begin>, integral_constant<size_t, Count>) {
+  return static_cast<typename E::value_type>(
+      vec_sum(e, integral_constant<size_t, Begin>{}, integral_constant<size_t, Count / 2>{}) +
+      vec_sum(e, integral_constant<size_t, Begin + Count / 2>{}, integral_constant<size_t, Count - Count / 2>{}));
+}
+
+}  // namespace detail
+
+//-------------------------------------------------------------------------------------------------
+// Operators and functions
+//-------------------------------------------------------------------------------------------------
+
+template <typename A, typename B>
+constexpr auto operator+(A&& a, B&& b) -> detail::vec_binary_result_t<detail::vec_ops::plus, A, B> {
+  return detail::vec_make<detail::vec_binary_result_t<detail::vec_ops::plus, A, B>>(jtc::forward<A>(a), jtc::forward<B>(b));
+}
+
+template <typename A, typename B>
+constexpr auto operator-(A&& a, B&& b) -> detail::vec_binary_result_t<detail::vec_ops::minus, A, B> {
+  return detail::vec_make<detail::vec_binary_result_t<detail::vec_ops::minus, A, B>>(jtc::forward<A>(a), jtc::forward<B>(b));
+}
+
+template <typename A, typename B>
+constexpr auto operator*(A&& a, B&& b) -> detail::vec_binary_result_t<detail::vec_ops::multiplies, A, B> {
+  return detail::vec_make<detail::vec_binary_result_t<detail::vec_ops::multiplies, A, B>>(jtc::forward<A>(a),
+                                                                                           jtc::forward<B>(b));
+}
+
+template <typename A, typename B>
+constexpr auto operator/(A&& a, B&& b) -> detail::vec_binary_result_t<detail::vec_ops::divides, A, B> {
+  return detail::vec_make<detail::vec_binary_result_t<detail::vec_ops::divides, A, B>>(jtc::forward<A>(a),
+                                                                                        jtc::forward<B>(b));
+}
+
+template <typename A, typename = enable_if_t<is_vec_expression_v<A>()>>
+constexpr detail::vec_unary<detail::vec_ops::negate, detail::vec_operand_t<A>> operator-(A&& a) {
+  return {jtc::forward<A>(a)};
+}
+
+/// Evaluates an expression into a vec, e.g. to keep a partial result that is used more than once
+template <typename E, typename = enable_if_t<is_vec_expression_v<E>()>>
+constexpr vec<typename remove_cvref_t<E>::value_type, remove_cvref_t<E>::size()> eval(const E& expression) {
+  return vec<typename remove_cvref_t<E>::value_type, remove_cvref_t<E>::size()>(expression);
+}
+
+/// Sum of the elements of an expression
+template <typename E, typename = enable_if_t<is_vec_expression_v<E>()>>
+constexpr typename remove_cvref_t<E>::value_type sum(const E& expression) {
+  return detail::vec_sum(expression, integral_constant<size_t, 0>{}, integral_constant<size_t, remove_cvref_t<E>::size()>{});
+}
+
+/// Dot product, fused with the expressions of both operands
+template <typename A, typename B, typename = enable_if_t<is_vec_expression_v<A>() && is_vec_expression_v<B>()>>
+constexpr typename remove_cvref_t<A>::value_type dot(A&& a, B&& b) {
+  return sum(jtc::forward<A>(a) * jtc::forward<B>(b));
+}
+
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+namespace vec_helpers {
+using vec3 = jtc::vec<int, 3>;
+constexpr vec3 a() { return vec3(1, 2, 3); }
+constexpr vec3 b() { return vec3(4, 5, 6); }
+constexpr int get(const vec3& v, jtc::size_t i) { return v[i]; }
+
+/// Whether V * S compiles
+template <typename V, typename S>
+struct scales {
+  template <typename T, typename = decltype(jtc::declval<const V&>() * jtc::declval<T>())>
+  constexpr static bool test(int) { return true; }
+  template <typename T>
+  constexpr static bool test(...) { return false; }
+
+  constexpr static bool value = test<S>(0);
+};
+}  // namespace vec_helpers
+
+struct vec_tests {
+  using vec3 = vec_helpers::vec3;
+
+  // Expressions on lvalues store references, and aren't evaluated into vecs
+  static_assert(jtc::is_same_v<decltype(jtc::declval<const vec3&>() + jtc::declval<const vec3&>()),
+                               jtc::detail::vec_binary<jtc::detail::vec_ops::plus, const vec3&, const vec3&>>(),
+                "JTC test failed!");
+  static_assert(sizeof(decltype(jtc::declval<const vec3&>() + jtc::declval<const vec3&>())) == 2 * sizeof(void*),
+                "JTC test failed!");
+
+  // Nested expressions (rvalues) are stored by value
+  static_assert(jtc::is_same_v<decltype(jtc::declval<vec3&>() * 2 - jtc::declval<vec3&>()),
+                               jtc::detail::vec_binary<jtc::detail::vec_ops::minus,
+                                                       jtc::detail::vec_binary<jtc::detail::vec_ops::multiplies,
+                                                                               const vec3&, jtc::detail::vec_scalar<int, 3>>,
+                                                       const vec3&>>(),
+                "JTC test failed!");
+
+  // Evaluation
+  static_assert(vec_helpers::get(vec_helpers::a(), 0) == 1 && vec_helpers::get(vec_helpers::a(), 2) == 3,
+                "JTC test failed!");
+  static_assert(vec_helpers::get(vec_helpers::a() * 2 + vec_helpers::b() - vec_helpers::a(), 1) == 2 * 2 + 5 - 2,
+                "JTC test failed!");
+  static_assert(vec_helpers::get(-vec_helpers::a() / 2, 2) == -1, "JTC test failed!");
+  static_assert(vec_helpers::get(10 - vec_helpers::a(), 0) == 9, "JTC test failed!");
+  static_assert(jtc::dot(vec_helpers::a(), vec_helpers::b()) == 1 * 4 + 2 * 5 + 3 * 6, "JTC test failed!");
+  static_assert(jtc::sum(jtc::vec<int, 5>::broadcast(3)) == 15, "JTC test failed!");
+
+  // Scalars must convert to the element type without narrowing
+  static_assert(vec_helpers::scales<vec3, int>::value && vec_helpers::scales<vec3, const short&>::value,
+                "JTC test failed!");
+  static_assert(!vec_helpers::scales<vec3, double>::value && !vec_helpers::scales<vec3, long long>::value,
+                "JTC test failed!");
+  static_assert(!vec_helpers::scales<vec3, unsigned>::value, "JTC test failed!");
+  static_assert(vec_helpers::scales<jtc::vec<double, 2>, float>::value, "JTC test failed!");
+  static_assert(!vec_helpers::scales<jtc::vec<float, 2>, double>::value, "JTC test failed!");
+
+  // Operators don't apply to other types
+  static_assert(!jtc::is_vec_expression_v<int>(), "JTC test failed!");
+  static_assert(jtc::is_vec_expression_v<const vec3&>(), "JTC test failed!");
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
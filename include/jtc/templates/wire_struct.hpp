@@ -0,0 +1,151 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// wire_struct.hpp: Zero-copy views of packed binary records, with per-field byte order
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TEMPLATES_WIRE_STRUCT_HPP
+#define JTC_TEMPLATES_WIRE_STRUCT_HPP
+
+#include "cv_ref_traits.hpp"
+#include "endian.hpp"
+#include "integer_sequence.hpp"
+#include "number_traits.hpp"
+#include "std_def.hpp"
+#include "type_list.hpp"
+
+namespace jtc {
+
+//-------------------------------------------------------------------------------------------------
+// wire_struct definition
+//
+// wire_struct<type_list<wire_field<T, Order>...>> is a view of a packed record in a byte buffer:
+//   the fields are stored back to back, without padding, each one in its own byte order.
+// Offsets are computed at compile time. get<I>() and set<I>() access the buffer directly, with a
+//   single unaligned load or store and a byte swap where needed: decoding doesn't copy the record.
+//
+// The view doesn't own the buffer, which must have at least size() bytes.
+// Use a const Byte type, e.g. wire_struct<Fields, const unsigned char>, for read-only buffers.
+//
+// Usage:
+//     using header = type_list<wire_field<uint16_t, endian::big>,      // type
+//                              wire_field<uint32_t, endian::big>,      // length
+//                              wire_field<int32_t, endian::little>>;   // checksum
+//     wire_struct<header, const unsigned char> view(received);
+//     if (view.get<0>() == 7) { uint32_t length = view.get<1>(); ... }
+//     const unsigned char* payload = received + view.size();
+//-------------------------------------------------------------------------------------------------
+
+/// A field of type T, stored in the byte order Order
+template <typename T, endian Order = endian::big>
+struct wire_field {
+  static_assert(is_integral_v<T>() && !is_same_v<remove_cv_t<T>, bool>(), "wire_field requires an integral type.");
+  using type = T;
+  constexpr static endian order = Order;
+};
+
+// Forward declaration of the implementation
+namespace detail {
+template <typename Fields, size_t I> constexpr size_t wire_offset();
+template <typename Fields> constexpr size_t wire_size();
+}  // namespace detail
+
+template <typename Fields, typename Byte = unsigned char>
+class wire_struct {
+  static_assert(is_same_v<remove_cv_t<Byte>, unsigned char>() || is_same_v<remove_cv_t<Byte>, char>(),
+                "wire_struct buffers must be of char or unsigned char.");
+
+ public:
+  /// The list of wire_field
+  using fields = Fields;
+
+  /// Type of the field I
+  template <size_t I>
+  using field_t = typename list_get_t<Fields, I>::type;
+
+  /// Number of fields
+  constexpr static size_t field_count() { return Fields::size; }
+
+  /// Size of the record, in bytes
+  constexpr static size_t size() { return detail::wire_size<Fields>(); }
+
+  /// Offset of the field I, in bytes
+  template <size_t I>
+  constexpr static size_t offset() { return detail::wire_offset<Fields, I>(); }
+
+  /// View of the record starting at data
+  explicit wire_struct(Byte* data) : data_(data) {}
+
+  /// Start of the record
+  Byte* data() const { return data_; }
+
+  /// Reads the field I
+  template <size_t I>
+  field_t<I> get() const {
+    return load_endian<field_t<I>, list_get_t<Fields, I>::order>(data_ + offset<I>());
+  }
+
+  /// Writes the field I
+  template <size_t I>
+  void set(field_t<I> value) const {
+    static_assert(!is_const_v<Byte>(), "Can't write to a read-only wire_struct.");
+    store_endian<list_get_t<Fields, I>::order>(data_ + offset<I>(), value);
+  }
+
+  /// View of the next record in the buffer, for arrays of records
+  wire_struct next() const { return wire_struct(data_ + size()); }
+
+ private:
+  Byte* data_;
+};
+
+//-------------------------------------------------------------------------------------------------
+// Layout implementation: offsets are the sum of the sizes of the previous fields
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+template <typename Fields, size_t I>
+constexpr size_t wire_offset() {
+  return I == 0 ? 0 : wire_offset<Fields, (I == 0 ? 0 : I - 1)>() + sizeof(typename list_get_t<Fields, (I == 0 ? 0 : I - 1)>::type);
+}
+
+template <typename Fields>
+constexpr size_t wire_size() {
+  return Fields::size == 0 ? 0 : wire_offset<Fields, Fields::size - 1>() + sizeof(typename list_get_t<Fields, Fields::size - 1>::type);
+}
+
+}  // namespace detail
+}  // namespace jtc
+
+//-------------------------------------------------------------------------------------------------
+// Compile-time Tests
+//-------------------------------------------------------------------------------------------------
+
+#ifdef JTC_TESTS
+
+namespace jtc {
+namespace tests {
+
+struct wire_struct_tests {
+  using header = jtc::wire_struct<jtc::type_list<jtc::wire_field<jtc::uint8_t>,
+                                                 jtc::wire_field<jtc::uint16_t, jtc::endian::big>,
+                                                 jtc::wire_field<jtc::int32_t, jtc::endian::little>,
+                                                 jtc::wire_field<jtc::uint64_t>>>;
+
+  static_assert(header::field_count() == 4, "JTC test failed!");
+  static_assert(header::offset<0>() == 0, "JTC test failed!");
+  static_assert(header::offset<1>() == 1, "JTC test failed!");
+  static_assert(header::offset<2>() == 3, "JTC test failed!");
+  static_assert(header::offset<3>() == 7, "JTC test failed!");
+  static_assert(header::size() == 15, "JTC test failed!");
+  static_assert(jtc::is_same_v<header::field_t<2>, jtc::int32_t>(), "JTC test failed!");
+};
+
+}  // namespace tests
+}  // namespace jtc
+
+#endif  // JTC_TESTS
+
+#endif
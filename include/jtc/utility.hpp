@@ -22,7 +22,7 @@
 // Template Metaprogramming Utilities
 //-------------------------------------------------------------------------------------------------
 
-// Emulates C++14's integer_sequence utility
+// Emulates C++14's integer_sequence utility, with scans, sorting and filtering at compile time
 #include "templates/integer_sequence.hpp"
 
 // Defines a type for search queries result
@@ -37,4 +37,31 @@
 // Boolean operations for parameter pack
 #include "templates/bool_operations.hpp"
 
+//-------------------------------------------------------------------------------------------------
+// Runtime type identification, without RTTI
+//-------------------------------------------------------------------------------------------------
+
+// Compact type IDs and tags from a closed type_list, with a reverse table of sizes and names
+#include "templates/type_id.hpp"
+
+// Sets of types from a closed type_list, as bitmasks computed at compile time
+#include "templates/type_bitset.hpp"
+
+//-------------------------------------------------------------------------------------------------
+// Static dispatch
+//-------------------------------------------------------------------------------------------------
+
+// Finite state machines, compiled from a type_list of transitions into a dense dispatch table
+#include "templates/state_machine.hpp"
+
+// Publish/subscribe event bus, with subscribers resolved from a type_map at compile time
+#include "templates/event_bus.hpp"
+
+//-------------------------------------------------------------------------------------------------
+// Instrumentation
+//-------------------------------------------------------------------------------------------------
+
+// Scoped tracing probes on the cycle counter, enabled by JTC_TRACE, with a compact dump format and histograms
+#include "templates/trace.hpp"
+
 #endif
\ No newline at end of file
@@ -0,0 +1,10 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// memory.cpp: Compile-time tests of memory.hpp
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// The tests are static_asserts: compiling this file runs them.
+#define JTC_TESTS
+#include "jtc/memory.hpp"
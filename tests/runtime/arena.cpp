@@ -0,0 +1,120 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// arena.cpp: Runtime tests of arena.hpp
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "check.hpp"
+#include "jtc/templates/arena.hpp"
+
+namespace {
+
+/// Records the order of destruction in a shared log
+struct logged {
+  static int log[16];
+  static int destroyed;
+  int id;
+
+  explicit logged(int id_) : id(id_) {}
+  ~logged() { log[destroyed++] = id; }
+};
+
+int logged::log[16];
+int logged::destroyed = 0;
+
+struct alignas(32) aligned_block { unsigned char bytes[32]; };
+
+template <typename T>
+bool is_aligned(const T* p) { return reinterpret_cast<jtc::size_t>(p) % alignof(T) == 0; }
+
+void check_allocation() {
+  alignas(64) unsigned char buffer[256];
+  jtc::arena<> a(buffer, sizeof(buffer));
+  JTC_CHECK(a.capacity() == 256 && a.used() == 0 && a.remaining() == 256);
+
+  // Construction from arguments, at the start of the buffer
+  int* i = a.make<int>(42);
+  JTC_CHECK(static_cast<void*>(i) == buffer && *i == 42 && a.used() == sizeof(int));
+
+  // Alignment padding is counted as used
+  char* c = a.make<char>('x');
+  aligned_block* block = a.make<aligned_block>();
+  JTC_CHECK(*c == 'x' && is_aligned(block) && reinterpret_cast<unsigned char*>(block) == buffer + 32);
+  JTC_CHECK(a.used() == 64 && a.remaining() == 192);
+
+  double* doubles = a.make_array<double>(24);
+  JTC_CHECK(doubles != nullptr && is_aligned(doubles) && a.remaining() == 0);
+
+  // Failures leave the arena unchanged
+  JTC_CHECK(a.make<char>('y') == nullptr && a.used() == 256);
+
+  a.reset();
+  JTC_CHECK(a.used() == 0 && a.make<int>(1) == i);
+}
+
+void check_failures() {
+  alignas(16) unsigned char buffer[64];
+  jtc::arena<> a(buffer, sizeof(buffer));
+  a.make<char>('a');
+
+  // Sizes that would wrap around when padding is added
+  const jtc::size_t max = ~jtc::size_t(0);
+  JTC_CHECK(a.allocate<8>(max) == nullptr);
+  JTC_CHECK(a.allocate<8>(max - 3) == nullptr);
+  JTC_CHECK(a.allocate<1>(max) == nullptr);
+  JTC_CHECK(a.make_array<double>(max / 4) == nullptr);
+  JTC_CHECK(a.used() == 1);
+
+  // Exact fit, after padding, then nothing more
+  JTC_CHECK(a.allocate<8>(56) == buffer + 8 && a.remaining() == 0);
+  JTC_CHECK(a.allocate<1>(0) == buffer + 64 && a.allocate<1>(1) == nullptr);
+
+  // A non-trivial object whose destructor node fits, but the object doesn't, rolls back the node
+  a.reset();
+  a.allocate<1>(64 - sizeof(void*) * 3 - 1);
+  const jtc::size_t used = a.used();
+  JTC_CHECK(a.make<logged>(0) == nullptr && a.used() == used);
+}
+
+void check_destruction() {
+  logged::destroyed = 0;
+  {
+    jtc::arena<512> a;
+    a.make<logged>(1);
+    a.make<int>(0);
+    a.make<logged>(2);
+    a.make<logged>(3);
+    JTC_CHECK(logged::destroyed == 0);
+
+    // Reverse order of construction
+    a.reset();
+    JTC_CHECK(logged::destroyed == 3 && logged::log[0] == 3 && logged::log[1] == 2 && logged::log[2] == 1);
+
+    // Each object is destroyed once
+    a.reset();
+    JTC_CHECK(logged::destroyed == 3);
+
+    a.make<logged>(4);
+    a.make<logged>(5);
+  }
+  // The destructor resets
+  JTC_CHECK(logged::destroyed == 5 && logged::log[3] == 5 && logged::log[4] == 4);
+
+  // On a caller-provided buffer too
+  alignas(16) unsigned char buffer[128];
+  {
+    jtc::arena<> a(buffer, sizeof(buffer));
+    a.make<logged>(6);
+  }
+  JTC_CHECK(logged::destroyed == 6 && logged::log[5] == 6);
+}
+
+}  // namespace
+
+int main() {
+  check_allocation();
+  check_failures();
+  check_destruction();
+  return jtc::tests::check_report("arena");
+}
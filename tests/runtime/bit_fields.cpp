@@ -0,0 +1,118 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// bit_fields.cpp: Runtime tests of bit_fields.hpp
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "check.hpp"
+#include "jtc/templates/bit_fields.hpp"
+
+namespace {
+
+struct mode {}; struct speed {}; struct enable {};
+struct a {}; struct b {}; struct c {}; struct d {}; struct e {};
+
+using control = jtc::bit_fields<jtc::bit_field<mode, 3>, jtc::bit_field<speed, 12>, jtc::bit_field<enable, 1>>;
+
+/// Fields that don't fit the rest of a word start the next one: a and b share word 0, c and d
+///   don't fit after them, and e fills a whole word
+using wide = jtc::bit_fields<jtc::bit_field<a, 40>, jtc::bit_field<b, 13>, jtc::bit_field<c, 20>,
+                             jtc::bit_field<d, 45>, jtc::bit_field<e, 64>>;
+
+/// Pseudo-random 64-bit values
+unsigned long long next(unsigned long long& state) {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+template <typename Fields, typename Tag>
+unsigned long long field_mask() {
+  return Fields::template bits<Tag>() == 64 ? ~0ULL : (1ULL << Fields::template bits<Tag>()) - 1;
+}
+
+void check_single_word() {
+  control reg(0xFFFF);
+  reg.set<speed>(0x123);
+  JTC_CHECK(reg.get<mode>() == 7 && reg.get<speed>() == 0x123 && reg.get<enable>() == 1);
+  JTC_CHECK(reg.word(0) == (0x8000 | (0x123 << 3) | 7));
+
+  // Bits beyond the field's width are discarded, and don't reach the neighbours
+  reg.set<mode>(0xF8);
+  JTC_CHECK(reg.get<mode>() == 0 && reg.get<speed>() == 0x123 && reg.get<enable>() == 1);
+
+  reg.update<enable, mode>(0, 5);
+  JTC_CHECK(reg.get<mode>() == 5 && reg.get<speed>() == 0x123 && reg.get<enable>() == 0);
+  reg.update<speed>(0xFFFF);
+  JTC_CHECK(reg.word(0) == ((0xFFF << 3) | 5));
+  reg.update<>();
+  JTC_CHECK(reg.word(0) == ((0xFFF << 3) | 5));
+}
+
+void check_layout() {
+  JTC_CHECK(wide::word_count() == 4);
+  JTC_CHECK(wide::word_index<b>() == 0 && wide::shift<b>() == 40);
+  JTC_CHECK(wide::word_index<c>() == 1 && wide::shift<c>() == 0);
+  JTC_CHECK(wide::word_index<d>() == 2 && wide::shift<d>() == 0);
+  JTC_CHECK(wide::word_index<e>() == 3 && wide::shift<e>() == 0);
+}
+
+/// Random writes through set() and update(), checked against a plain array of the fields
+void check_many_words() {
+  unsigned long long state = 0x9E3779B97F4A7C15ULL;
+  unsigned long long expected[5] = {};
+  const unsigned long long masks[5] = {field_mask<wide, a>(), field_mask<wide, b>(), field_mask<wide, c>(),
+                                       field_mask<wide, d>(), field_mask<wide, e>()};
+  wide fields;
+
+  auto matches = [&]() {
+    return fields.get<a>() == expected[0] && fields.get<b>() == expected[1] && fields.get<c>() == expected[2] &&
+           fields.get<d>() == expected[3] && fields.get<e>() == expected[4];
+  };
+
+  for (int round = 0; round < 200; round++) {
+    // One field at a time
+    const unsigned long long value = next(state);
+    switch (round % 5) {
+      case 0: fields.set<a>(value); break;
+      case 1: fields.set<b>(static_cast<wide::value_t<b>>(value)); break;
+      case 2: fields.set<c>(static_cast<wide::value_t<c>>(value)); break;
+      case 3: fields.set<d>(value); break;
+      default: fields.set<e>(value); break;
+    }
+    expected[round % 5] = value & masks[round % 5];
+    if (!JTC_CHECK(matches())) return;
+
+    // Fields of several words at once, in any order
+    const unsigned long long v1 = next(state), v2 = next(state), v3 = next(state);
+    if (round % 2) {
+      fields.update<d, a, c>(v1, v2, static_cast<wide::value_t<c>>(v3));
+      expected[3] = v1 & masks[3];
+      expected[0] = v2 & masks[0];
+      expected[2] = v3 & masks[2];
+    } else {
+      fields.update<e, b>(v1, static_cast<wide::value_t<b>>(v2));
+      expected[4] = v1 & masks[4];
+      expected[1] = v2 & masks[1];
+    }
+    if (!JTC_CHECK(matches())) return;
+  }
+
+  // All fields at once
+  fields.update<a, b, c, d, e>(0, 0, 0, 0, 0);
+  JTC_CHECK(fields.word(0) == 0 && fields.word(1) == 0 && fields.word(2) == 0 && fields.word(3) == 0);
+  fields.update<a, b, c, d, e>(~0ULL, 0xFFFF, 0xFFFFFFFF, ~0ULL, ~0ULL);
+  JTC_CHECK(fields.word(0) == ~0ULL >> 11 && fields.word(1) == 0xFFFFF && fields.word(2) == ~0ULL >> 19);
+  JTC_CHECK(fields.word(3) == ~0ULL);
+}
+
+}  // namespace
+
+int main() {
+  check_single_word();
+  check_layout();
+  check_many_words();
+  return jtc::tests::check_report("bit_fields");
+}
@@ -0,0 +1,44 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// check.hpp: Assertions of the runtime tests, which count failures instead of aborting
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef JTC_TESTS_RUNTIME_CHECK_HPP
+#define JTC_TESTS_RUNTIME_CHECK_HPP
+
+#include <stdio.h>
+
+namespace jtc {
+namespace tests {
+
+/// Number of failed checks in the program
+inline int& check_failures() {
+  static int failures = 0;
+  return failures;
+}
+
+/// Reports a failed check. Returns whether it passed, so a test can stop on failure.
+inline bool check(bool passed, const char* expression, const char* file, int line) {
+  if (!passed) {
+    fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+    check_failures()++;
+  }
+  return passed;
+}
+
+/// Prints the outcome of the program, and returns its exit status
+inline int check_report(const char* name) {
+  if (check_failures() == 0) printf("%s: all checks passed\n", name);
+  else fprintf(stderr, "%s: %d checks failed\n", name, check_failures());
+  return check_failures() == 0 ? 0 : 1;
+}
+
+}  // namespace tests
+}  // namespace jtc
+
+// Variadic, so expressions with commas in template arguments don't need extra parentheses
+#define JTC_CHECK(...) ::jtc::tests::check(static_cast<bool>(__VA_ARGS__), #__VA_ARGS__, __FILE__, __LINE__)
+
+#endif
@@ -0,0 +1,88 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// crc.cpp: Runtime tests of crc.hpp
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "check.hpp"
+#include "jtc/templates/crc.hpp"
+
+namespace {
+
+/// Bit-by-bit CRC, straight from the model's definition, as a reference for the table-driven kernels
+template <typename Model>
+typename Model::value_type reference(const unsigned char* data, jtc::size_t size) {
+  using T = typename Model::value_type;
+  constexpr unsigned bits = sizeof(T) * 8;
+  const T top = static_cast<T>(T(1) << (bits - 1));
+
+  auto reflect = [](T value, unsigned width) {
+    T result = 0;
+    for (unsigned i = 0; i < width; i++)
+      if (value & (T(1) << i)) result = static_cast<T>(result | (T(1) << (width - 1 - i)));
+    return result;
+  };
+
+  T state = Model::initial;
+  for (jtc::size_t i = 0; i < size; i++) {
+    const unsigned char byte = Model::reflected ? static_cast<unsigned char>(reflect(data[i], 8)) : data[i];
+    state = static_cast<T>(state ^ (static_cast<T>(byte) << (bits - 8)));
+    for (int bit = 0; bit < 8; bit++)
+      state = (state & top) ? static_cast<T>((state << 1) ^ Model::polynomial) : static_cast<T>(state << 1);
+  }
+  if (Model::reflected) state = reflect(state, bits);
+  return static_cast<T>(state ^ Model::final_xor);
+}
+
+unsigned char data[64 + 16];
+
+/// Lengths 0 to 64, from every offset up to Slices, so both the blocks and the byte-wise tail are
+///   exercised from unaligned starts
+template <typename Model, jtc::size_t Slices>
+void check_sliced() {
+  using crc = jtc::crc<Model>;
+  for (jtc::size_t offset = 0; offset <= Slices; offset++) {
+    for (jtc::size_t size = 0; size <= 64; size++) {
+      const unsigned char* bytes = data + offset;
+      const typename Model::value_type expected = crc::compute(bytes, size);
+      if (!JTC_CHECK(crc::template compute_sliced<Slices>(bytes, size) == expected)) return;
+
+      // Split in two updates, so the second one starts with a non-initial register
+      const jtc::size_t half = size / 3;
+      const auto state = crc::template update_sliced<Slices>(crc::init(), bytes, half);
+      if (!JTC_CHECK(crc::finalize(crc::template update_sliced<Slices>(state, bytes + half, size - half)) == expected))
+        return;
+    }
+  }
+}
+
+template <typename Model>
+void check_model() {
+  using crc = jtc::crc<Model>;
+  const unsigned char check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+  JTC_CHECK(crc::compute(check, sizeof(check)) == crc::literal("123456789"));
+
+  for (jtc::size_t size = 0; size <= 64; size++)
+    if (!JTC_CHECK(crc::compute(data + 3, size) == reference<Model>(data + 3, size))) break;
+
+  check_sliced<Model, 8>();
+  check_sliced<Model, 16>();
+}
+
+}  // namespace
+
+int main() {
+  for (jtc::size_t i = 0; i < sizeof(data); i++) data[i] = static_cast<unsigned char>(i * 167 + 13);
+
+  check_model<jtc::crc8_model>();
+  check_model<jtc::crc16_ccitt_model>();
+  check_model<jtc::crc16_arc_model>();
+  check_model<jtc::crc32_model>();
+  check_model<jtc::crc32c_model>();
+  check_model<jtc::crc64_model>();
+  check_sliced<jtc::crc8_model, 1>();
+  check_sliced<jtc::crc16_arc_model, 2>();
+  check_sliced<jtc::crc32_model, 4>();
+  return jtc::tests::check_report("crc");
+}
@@ -0,0 +1,88 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// event_bus.cpp: Runtime tests of event_bus.hpp
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "check.hpp"
+#include "jtc/templates/event_bus.hpp"
+
+namespace {
+
+struct button_pressed {};
+struct battery_low { int percent; };
+struct unused {};
+
+/// Order in which the handlers were called, across all of them
+int sequence = 0;
+
+struct display {
+  int presses = 0;
+  int percent = -1;
+  int last_call = 0;
+  void operator()(const button_pressed&) {
+    presses++;
+    last_call = ++sequence;
+  }
+  void operator()(const battery_low& e) {
+    percent = e.percent;
+    last_call = ++sequence;
+  }
+};
+
+struct logger {
+  int count = 0;
+  int last_call = 0;
+  void operator()(const battery_low&) {
+    count++;
+    last_call = ++sequence;
+  }
+};
+
+using bus_type = jtc::event_bus<jtc::type_map<jtc::map_node<button_pressed, jtc::type_list<display>>,
+                                              jtc::map_node<battery_low, jtc::type_list<logger, display>>>>;
+
+void check_publish() {
+  bus_type bus;
+  const bus_type& cbus = bus;
+  JTC_CHECK(bus.handler<display>().presses == 0 && bus.handler<logger>().count == 0);
+
+  // Only the subscribers of the event are called
+  bus.publish(button_pressed{});
+  JTC_CHECK(cbus.handler<display>().presses == 1 && cbus.handler<display>().percent == -1);
+  JTC_CHECK(cbus.handler<logger>().count == 0);
+
+  // Subscribers are called in list order, with the published event
+  bus.publish(battery_low{15});
+  JTC_CHECK(bus.handler<logger>().count == 1 && bus.handler<display>().percent == 15);
+  JTC_CHECK(bus.handler<logger>().last_call + 1 == bus.handler<display>().last_call);
+  JTC_CHECK(bus.handler<display>().presses == 1);
+
+  // Events without subscribers are ignored
+  const int calls = sequence;
+  bus.publish(unused{});
+  JTC_CHECK(sequence == calls);
+}
+
+void check_instances() {
+  // A handler subscribed to several events is a single instance, which keeps its state across them
+  bus_type bus;
+  bus.publish(battery_low{40});
+  bus.publish(button_pressed{});
+  bus.publish(button_pressed{});
+  JTC_CHECK(bus.handler<display>().presses == 2 && bus.handler<display>().percent == 40);
+
+  // Each bus has its own handlers
+  bus_type other;
+  JTC_CHECK(other.handler<display>().presses == 0 && other.handler<logger>().count == 0);
+  JTC_CHECK(&other.handler<display>() != &bus.handler<display>());
+}
+
+}  // namespace
+
+int main() {
+  check_publish();
+  check_instances();
+  return jtc::tests::check_report("event_bus");
+}
@@ -0,0 +1,95 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// fixed_point.cpp: Runtime tests of fixed_point.hpp
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <math.h>
+
+#include "check.hpp"
+#include "jtc/templates/fixed_point.hpp"
+
+namespace {
+
+/// Expected representation of value, computed in long double, which holds every scaled float and double exactly
+template <typename Fixed, typename T>
+long long expected_raw(T value, bool rounds) {
+  const long long max = static_cast<long long>(Fixed::max().raw());
+  const long long min = static_cast<long long>(Fixed::lowest().raw());
+  if (isnan(value)) return max;
+
+  const long double scaled = static_cast<long double>(value) * ldexpl(1.0L, static_cast<int>(Fixed::fractional_bits));
+  if (scaled >= static_cast<long double>(max) + 1) return max;
+  if (scaled < static_cast<long double>(min)) return min;
+
+  long double integer = floorl(scaled);
+  if (rounds) integer = scaled < 0 ? -floorl(-scaled + 0.5L) : floorl(scaled + 0.5L);
+  return integer > max ? max : static_cast<long long>(integer);
+}
+
+template <typename Fixed, typename T>
+bool check_value(T value, bool rounds) {
+  if (JTC_CHECK(static_cast<long long>(Fixed(value).raw()) == expected_raw<Fixed>(value, rounds))) return true;
+  fprintf(stderr, "  value: %.17g\n", static_cast<double>(value));
+  return false;
+}
+
+/// Values around each limit of the format, both representable and not, and far out of range
+template <typename Fixed, typename T>
+void check_format(bool rounds) {
+  const T limits[] = {static_cast<T>(Fixed::max()), static_cast<T>(Fixed::lowest()), T(0)};
+  const T far[] = {T(1e10), T(-1e10), T(1e30), T(-1e30), T(INFINITY), T(-INFINITY), T(NAN), T(40000), T(-40000)};
+
+  for (T limit : limits) {
+    T value = limit;
+    for (int i = 0; i < 64; i++) value = nextafter(value, T(INFINITY));
+    for (int i = 0; i < 128; i++, value = nextafter(value, -T(INFINITY))) {
+      if (!check_value<Fixed>(value, rounds)) return;
+    }
+  }
+
+  for (T value : far) {
+    if (!check_value<Fixed>(value, rounds)) return;
+  }
+
+  // Halves, where the rounding policies differ, around 2^23 when scaled: float has no halves above it
+  const long long bases[] = {0, 1LL << 23, -(1LL << 23)};
+  for (long long raw = -40; raw <= 40; raw++) {
+    for (long long base : bases) {
+      const int exponent = -1 - static_cast<int>(Fixed::fractional_bits);
+      const T value = static_cast<T>(ldexp(static_cast<double>(base * 2 + raw), exponent));
+      if (!check_value<Fixed>(value, rounds)) return;
+    }
+  }
+}
+
+template <typename Fixed>
+void check_floating(bool rounds) {
+  check_format<Fixed, float>(rounds);
+  check_format<Fixed, double>(rounds);
+}
+
+namespace policy = jtc::fixed_policy;
+
+}  // namespace
+
+int main() {
+  // Conversions from floating-point always saturate, whatever the overflow policy
+  check_floating<jtc::fixed<16, 16>>(false);
+  check_floating<jtc::fixed<16, 16, policy::round, policy::saturate>>(true);
+  check_floating<jtc::ufixed<16, 16, policy::round, policy::saturate>>(true);
+  check_floating<jtc::ufixed<32, 0>>(false);
+  check_floating<jtc::fixed<32, 0, policy::round>>(true);
+  check_floating<jtc::fixed<1, 15, policy::round, policy::saturate>>(true);
+  check_floating<jtc::fixed<8, 8>>(false);
+  check_floating<jtc::ufixed<4, 4, policy::truncate, policy::wrap>>(false);
+  check_floating<jtc::fixed<4, 20, policy::round>>(true);
+
+  // The cases of the review: 2^31 in a float doesn't fit int32_t
+  JTC_CHECK(jtc::fixed<16, 16>(40000.f).raw() == 0x7FFFFFFF);
+  JTC_CHECK(jtc::fixed<16, 16>(1e10f).raw() == 0x7FFFFFFF && jtc::fixed<16, 16>(-1e10f).raw() == -0x7FFFFFFF - 1);
+  JTC_CHECK(jtc::ufixed<16, 16, policy::round, policy::saturate>(1e10f).raw() == 0xFFFFFFFFu);
+  JTC_CHECK(jtc::ufixed<16, 16, policy::round, policy::saturate>(-1.0).raw() == 0);
+  return jtc::tests::check_report("fixed_point");
+}
@@ -0,0 +1,168 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// inplace_any.cpp: Runtime tests of inplace_any.hpp
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "check.hpp"
+#include "jtc/templates/inplace_any.hpp"
+
+namespace {
+
+/// Counts live instances, copies and moves, to check which operation each member calls
+struct counted {
+  static int live;
+  static int copies;
+  static int moves;
+  int value;
+
+  explicit counted(int value_) : value(value_) { live++; }
+  counted(const counted& other) : value(other.value) {
+    live++;
+    copies++;
+  }
+  counted(counted&& other) noexcept : value(other.value) {
+    other.value = -1;
+    live++;
+    moves++;
+  }
+  ~counted() { live--; }
+
+  static void clear() { copies = moves = 0; }
+};
+
+int counted::live = 0;
+int counted::copies = 0;
+int counted::moves = 0;
+
+struct pair {
+  short a;
+  long b;
+};
+
+using any = jtc::inplace_any<32>;
+
+#ifdef JTC_TYPE_SIGNATURE
+bool name_is(jtc::span<const char> name, const char* text) {
+  jtc::size_t i = 0;
+  for (; i < name.size(); i++)
+    if (text[i] != name[i]) return false;
+  return text[i] == '\0';
+}
+#endif
+
+void check_emplace() {
+  any a;
+  JTC_CHECK(!a.has_value() && a.type_name().empty() && !a.is<int>());
+  JTC_CHECK(jtc::any_cast<int>(&a) == nullptr);
+
+  int& i = a.emplace<int>(42);
+  JTC_CHECK(a.has_value() && a.is<int>() && !a.is<unsigned>() && i == 42);
+  JTC_CHECK(jtc::any_cast<int>(&a) == &i);
+
+  // Replacing the value destroys the previous one
+  counted::clear();
+  counted& c = a.emplace<counted>(7);
+  JTC_CHECK(c.value == 7 && counted::live == 1 && counted::copies == 0 && counted::moves == 0);
+  pair& p = a.emplace<pair>(pair{3, 4});
+  JTC_CHECK(counted::live == 0 && p.a == 3 && p.b == 4 && a.is<pair>());
+
+  // Assigning a value emplaces a copy or a move of it
+  const counted source(5);
+  a = source;
+  JTC_CHECK(counted::live == 2 && counted::copies == 1 && jtc::any_cast<counted>(&a)->value == 5);
+  a = counted(6);
+  JTC_CHECK(counted::live == 2 && counted::moves == 1 && jtc::any_cast<counted>(&a)->value == 6);
+
+  a.reset();
+  JTC_CHECK(!a.has_value() && counted::live == 1);
+  a.reset();
+  JTC_CHECK(!a.has_value() && counted::live == 1);
+
+#ifdef JTC_TYPE_SIGNATURE
+  a.emplace<double>(1.5);
+  JTC_CHECK(name_is(a.type_name(), "double"));
+#endif
+}
+
+void check_any_cast() {
+  any a = 3.5;
+  const any& ca = a;
+
+  // Hits: the stored type exactly
+  JTC_CHECK(jtc::any_cast<double>(&a) != nullptr && *jtc::any_cast<double>(&a) == 3.5);
+  JTC_CHECK(jtc::any_cast<double>(&ca) == jtc::any_cast<double>(&a));
+
+  JTC_CHECK(jtc::any_cast<const double>(&a) == jtc::any_cast<double>(&a) && a.is<const double>());
+
+  // Misses: any other type, even a convertible or same-sized one, and empty or null anys
+  JTC_CHECK(jtc::any_cast<float>(&a) == nullptr && jtc::any_cast<long long>(&a) == nullptr);
+  JTC_CHECK(jtc::any_cast<int>(&ca) == nullptr && jtc::any_cast<const int>(&ca) == nullptr);
+  any* null = nullptr;
+  JTC_CHECK(jtc::any_cast<double>(null) == nullptr);
+  a.reset();
+  JTC_CHECK(jtc::any_cast<double>(&a) == nullptr && jtc::any_cast<double>(&ca) == nullptr);
+
+  // The cast pointer can modify the value
+  a = 10;
+  *jtc::any_cast<int>(&a) += 1;
+  JTC_CHECK(*jtc::any_cast<int>(&ca) == 11);
+}
+
+void check_copy_move() {
+  counted::clear();
+  {
+    any a = counted(1);
+    JTC_CHECK(counted::live == 1 && counted::moves == 1);
+
+    // Copies are independent
+    any b(a);
+    JTC_CHECK(counted::live == 2 && counted::copies == 1 && b.is<counted>());
+    jtc::any_cast<counted>(&b)->value = 2;
+    JTC_CHECK(jtc::any_cast<counted>(&a)->value == 1);
+
+    // Moving leaves the source holding a moved-from value, destroyed with it
+    any c(jtc::move(a));
+    JTC_CHECK(counted::live == 3 && counted::moves == 2 && jtc::any_cast<counted>(&c)->value == 1);
+    JTC_CHECK(a.has_value() && jtc::any_cast<counted>(&a)->value == -1);
+
+    // Assignment destroys the previous value first
+    any d = 8;
+    d = b;
+    JTC_CHECK(counted::live == 4 && counted::copies == 2 && jtc::any_cast<counted>(&d)->value == 2);
+    d = jtc::move(c);
+    JTC_CHECK(counted::live == 4 && counted::moves == 3 && jtc::any_cast<counted>(&d)->value == 1);
+    b = any();
+    JTC_CHECK(counted::live == 3 && !b.has_value());
+
+    // Self-assignment keeps the value
+    any& self = d;
+    d = self;
+    d = jtc::move(self);
+    JTC_CHECK(counted::live == 3 && jtc::any_cast<counted>(&d)->value == 1);
+
+    // Empty values copy and move as empty
+    any e(b);
+    any f(jtc::move(b));
+    JTC_CHECK(!e.has_value() && !f.has_value());
+  }
+  JTC_CHECK(counted::live == 0);
+}
+
+void check_alignment() {
+  jtc::inplace_any<64, 32> a;
+  struct alignas(32) wide { char bytes[32]; };
+  wide& w = a.emplace<wide>();
+  JTC_CHECK(reinterpret_cast<jtc::size_t>(&w) % 32 == 0 && a.is<wide>());
+}
+
+}  // namespace
+
+int main() {
+  check_emplace();
+  check_any_cast();
+  check_copy_move();
+  check_alignment();
+  return jtc::tests::check_report("inplace_any");
+}
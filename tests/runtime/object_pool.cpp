@@ -0,0 +1,122 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// object_pool.cpp: Runtime tests of object_pool.hpp
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "check.hpp"
+#include "jtc/templates/declval.hpp"
+#include "jtc/templates/object_pool.hpp"
+#include "jtc/templates/sfinae_types.hpp"
+
+namespace {
+
+/// Counts live instances, to check that acquire constructs and release destroys
+struct counted {
+  static int live;
+  int a;
+  double b;
+
+  counted(int a_, double b_) : a(a_), b(b_) { live++; }
+  ~counted() { live--; }
+};
+
+int counted::live = 0;
+
+struct ping { char id; };
+struct packet { jtc::uint32_t words[4]; };
+
+/// Whether Pool::release accepts a T*
+template <typename Pool, typename T, typename = void>
+struct can_release : jtc::false_type {};
+
+template <typename Pool, typename T>
+struct can_release<Pool, T, jtc::void_t<decltype(jtc::declval<Pool&>().release(jtc::declval<T*>()))>> : jtc::true_type {};
+
+using multi = jtc::multi_pool<jtc::type_list<ping, packet>, 4>;
+static_assert(can_release<multi, ping>::value && can_release<multi, packet>::value, "JTC test failed!");
+static_assert(!can_release<multi, int>::value && !can_release<multi, const ping>::value, "JTC test failed!");
+
+void check_object_pool() {
+  jtc::object_pool<counted, 4> pool;
+  JTC_CHECK(pool.empty() && !pool.full() && pool.capacity() == 4);
+
+  // Slots are taken in order, and constructed from the arguments
+  counted* p[4];
+  for (int i = 0; i < 4; i++) p[i] = pool.acquire(i, i * 0.5);
+  JTC_CHECK(p[0]->a == 0 && p[3]->a == 3 && p[3]->b == 1.5 && counted::live == 4);
+  JTC_CHECK(pool.index_of(p[0]) == 0 && pool.index_of(p[1]) == 1 && pool.index_of(p[3]) == 3);
+  JTC_CHECK(&pool[2] == p[2] && pool[2].a == 2);
+  JTC_CHECK(pool.full() && pool.size() == 4);
+
+  // Full: nothing is constructed
+  JTC_CHECK(pool.acquire(9, 9.0) == nullptr && counted::live == 4 && pool.size() == 4);
+
+  // Released slots are reused last-in, first-out
+  pool.release(p[1]);
+  pool.release(p[3]);
+  JTC_CHECK(pool.size() == 2 && counted::live == 2 && !pool.full());
+  counted* reused = pool.acquire(30, 0.0);
+  JTC_CHECK(reused == p[3] && reused->a == 30);
+  reused = pool.acquire(10, 0.0);
+  JTC_CHECK(reused == p[1] && reused->a == 10);
+  JTC_CHECK(pool.acquire(0, 0.0) == nullptr);
+
+  // Ownership: slot starts only
+  counted outside(0, 0.0);
+  JTC_CHECK(pool.owns(p[0]) && pool.owns(p[3]));
+  JTC_CHECK(!pool.owns(&outside));
+  JTC_CHECK(!pool.owns(reinterpret_cast<const counted*>(reinterpret_cast<const char*>(p[1]) + 1)));
+  JTC_CHECK(!pool.owns(p[3] + 1));
+
+  for (int i = 0; i < 4; i++) pool.release(p[i]);
+  JTC_CHECK(pool.empty() && counted::live == 1);
+}
+
+void check_small_objects() {
+  // Objects smaller than the index type: each slot still holds a link
+  jtc::object_pool<jtc::uint8_t, 300> pool;
+  jtc::uint8_t* first = pool.acquire(jtc::uint8_t(1));
+  jtc::uint8_t* second = pool.acquire(jtc::uint8_t(2));
+  JTC_CHECK(pool.index_of(second) == 1 && *first == 1 && *second == 2);
+
+  pool.release(first);
+  pool.release(second);
+  JTC_CHECK(pool.acquire(jtc::uint8_t(3)) == second && pool.acquire(jtc::uint8_t(4)) == first);
+
+  int count = 2;
+  while (pool.acquire(jtc::uint8_t(0)) != nullptr) count++;
+  JTC_CHECK(count == 300 && pool.full());
+}
+
+void check_multi_pool() {
+  multi pool;
+  ping* a = pool.acquire<ping>(ping{'a'});
+  packet* b = pool.acquire<packet>();
+  ping* c = pool.acquire<ping>(ping{'c'});
+  JTC_CHECK(a->id == 'a' && c->id == 'c' && pool.size() == 3);
+  JTC_CHECK(pool.index_of(a) == 0 && pool.index_of(b) == 1 && pool.index_of(c) == 2);
+  const ping outside{'o'};
+  JTC_CHECK(pool.owns(a) && pool.owns(b) && !pool.owns(&outside));
+
+  // Slots are shared: a freed ping slot holds a packet
+  pool.release(a);
+  packet* d = pool.acquire<packet>();
+  JTC_CHECK(static_cast<void*>(d) == static_cast<void*>(a));
+  d->words[3] = 0xFFFFFFFF;
+  JTC_CHECK(reinterpret_cast<jtc::size_t>(d) % multi::slot_alignment() == 0);
+
+  JTC_CHECK(pool.acquire<ping>() != nullptr && pool.full());
+  JTC_CHECK(pool.acquire<packet>() == nullptr);
+}
+
+}  // namespace
+
+int main() {
+  check_object_pool();
+  check_small_objects();
+  check_multi_pool();
+  JTC_CHECK(counted::live == 0);
+  return jtc::tests::check_report("object_pool");
+}
@@ -0,0 +1,232 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// saturating.cpp: Runtime tests of saturating.hpp
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// Every result is compared with the exact one, computed in __int128: exhaustively for 8-bit operands,
+//   and for edge values of the wider types.
+// The portable implementation is compiled on every target, so it's tested against the same results
+//   as the builtins. Building with -DJTC_HAS_BUILTIN_OVERFLOW=0 also routes the public functions through it.
+
+#include "check.hpp"
+#include "jtc/templates/saturating.hpp"
+
+#ifndef __SIZEOF_INT128__
+#error "The reference results are computed in __int128."
+#endif
+
+namespace {
+
+__extension__ typedef __int128 exact_t;
+__extension__ typedef unsigned __int128 unsigned_exact_t;
+
+using jtc::int_max;
+using jtc::int_min;
+
+//-------------------------------------------------------------------------------------------------
+// Operations under test
+//-------------------------------------------------------------------------------------------------
+
+struct add_case {
+  using op = jtc::detail::add_op;
+  static exact_t exact(exact_t a, exact_t b) { return a + b; }
+  template <typename R, typename A, typename B>
+  static bool overflow(A a, B b, R& result) { return jtc::add_overflow(a, b, result); }
+  template <typename R, typename A, typename B>
+  static R saturate(A a, B b) { return jtc::sat_add<R>(a, b); }
+  template <typename T>
+  static jtc::checked_result<T> checked(T a, T b) { return jtc::checked_add(a, b); }
+};
+
+struct sub_case {
+  using op = jtc::detail::sub_op;
+  static exact_t exact(exact_t a, exact_t b) { return a - b; }
+  template <typename R, typename A, typename B>
+  static bool overflow(A a, B b, R& result) { return jtc::sub_overflow(a, b, result); }
+  template <typename R, typename A, typename B>
+  static R saturate(A a, B b) { return jtc::sat_sub<R>(a, b); }
+  template <typename T>
+  static jtc::checked_result<T> checked(T a, T b) { return jtc::checked_sub(a, b); }
+};
+
+struct mul_case {
+  using op = jtc::detail::mul_op;
+  /// Products of two 64-bit unsigned values may not fit: those keep the wrapped low 64 bits, above any R
+  static exact_t exact(exact_t a, exact_t b) {
+    const unsigned_exact_t product = static_cast<unsigned_exact_t>(a) * static_cast<unsigned_exact_t>(b);
+    const bool too_large = a > 0 && b > 0 && static_cast<unsigned_exact_t>(a) > (~unsigned_exact_t(0) >> 1) / static_cast<unsigned_exact_t>(b);
+    return too_large ? (exact_t(1) << 100) | static_cast<exact_t>(static_cast<jtc::uint64_t>(product)) : a * b;
+  }
+  template <typename R, typename A, typename B>
+  static bool overflow(A a, B b, R& result) { return jtc::mul_overflow(a, b, result); }
+  template <typename R, typename A, typename B>
+  static R saturate(A a, B b) { return jtc::sat_mul<R>(a, b); }
+  template <typename T>
+  static jtc::checked_result<T> checked(T a, T b) { return jtc::checked_mul(a, b); }
+};
+
+//-------------------------------------------------------------------------------------------------
+// Checks of one operation
+//-------------------------------------------------------------------------------------------------
+
+/// Which functions support the operand types, besides the builtins
+enum class operands {
+  narrow,     ///< Up to 32 bits: everything
+  same_wide,  ///< 64 bits, all of the same type: everything
+  mixed_wide  ///< 64 bits, mixed: only the builtins
+};
+
+template <typename R, typename A, typename B>
+constexpr operands operand_kind() {
+  return sizeof(A) <= 4 && sizeof(B) <= 4                                ? operands::narrow
+         : jtc::is_same_v<A, B>() && jtc::is_same_v<A, R>()              ? operands::same_wide
+                                                                          : operands::mixed_wide;
+}
+
+template <operands Kind>
+using operands_constant = jtc::integral_constant<operands, Kind>;
+
+struct expected_result {
+  exact_t exact;
+  bool overflow;
+};
+
+template <typename Case, typename R, typename A, typename B>
+bool check_portable(A a, B b, expected_result expected, operands_constant<operands::narrow>) {
+  R result;
+  const bool overflow = jtc::detail::overflow_portable<typename Case::op>(a, b, result, jtc::true_type{});
+  return JTC_CHECK(overflow == expected.overflow && result == static_cast<R>(expected.exact));
+}
+
+template <typename Case, typename R, typename A, typename B>
+bool check_portable(A a, B b, expected_result expected, operands_constant<operands::same_wide>) {
+  R result;
+  const bool overflow = jtc::detail::overflow_portable<typename Case::op>(a, b, result, jtc::false_type{});
+  return JTC_CHECK(overflow == expected.overflow && result == static_cast<R>(expected.exact));
+}
+
+template <typename Case, typename R, typename A, typename B>
+bool check_portable(A, B, expected_result, operands_constant<operands::mixed_wide>) {
+  return true;
+}
+
+/// The public functions, which use the builtins unless JTC_HAS_BUILTIN_OVERFLOW is 0
+template <typename Case, typename R, typename A, typename B, operands Kind>
+bool check_public(A a, B b, expected_result expected, operands_constant<Kind>) {
+  R result;
+  const bool overflow = Case::overflow(a, b, result);
+  const R saturated = expected.overflow ? (expected.exact < 0 ? int_min<R>() : int_max<R>()) : static_cast<R>(expected.exact);
+  return JTC_CHECK(overflow == expected.overflow && result == static_cast<R>(expected.exact)) &&
+         JTC_CHECK(Case::template saturate<R>(a, b) == saturated);
+}
+
+template <typename Case, typename R, typename A, typename B>
+bool check_public(A a, B b, expected_result expected, operands_constant<operands::mixed_wide>) {
+#if JTC_HAS_BUILTIN_OVERFLOW
+  R result;
+  const bool overflow = Case::overflow(a, b, result);
+  return JTC_CHECK(overflow == expected.overflow && result == static_cast<R>(expected.exact));
+#else
+  return (void)a, (void)b, (void)expected, true;
+#endif
+}
+
+template <typename Case, typename T>
+bool check_checked(T a, T b, expected_result expected, jtc::true_type /* same types */) {
+  const jtc::checked_result<T> result = Case::checked(a, b);
+  return JTC_CHECK(result.overflow == expected.overflow && result.value == static_cast<T>(expected.exact));
+}
+
+template <typename Case, typename A, typename B>
+bool check_checked(A, B, expected_result, jtc::false_type) {
+  return true;
+}
+
+template <typename Case, typename R, typename A, typename B>
+bool check_operation(A a, B b) {
+  expected_result expected;
+  expected.exact = Case::exact(a, b);
+  expected.overflow = expected.exact < static_cast<exact_t>(int_min<R>()) || expected.exact > static_cast<exact_t>(int_max<R>());
+
+  const operands_constant<operand_kind<R, A, B>()> kind{};
+  const bool same_types = jtc::is_same_v<A, B>() && jtc::is_same_v<A, R>();
+  const bool passed = check_portable<Case, R>(a, b, expected, kind) && check_public<Case, R>(a, b, expected, kind) &&
+                      check_checked<Case>(a, b, expected, jtc::bool_constant<same_types>{});
+  if (!passed)
+    fprintf(stderr, "  with a = %lld, b = %lld\n", static_cast<long long>(a), static_cast<long long>(b));
+  return passed;
+}
+
+template <typename R, typename A, typename B>
+bool check_operations(A a, B b) {
+  return check_operation<add_case, R>(a, b) && check_operation<sub_case, R>(a, b) && check_operation<mul_case, R>(a, b);
+}
+
+//-------------------------------------------------------------------------------------------------
+// Operand values
+//-------------------------------------------------------------------------------------------------
+
+/// Every pair of values of 8-bit types
+template <typename R, typename A, typename B>
+void check_exhaustive() {
+  for (int a = int_min<A>(); a <= int_max<A>(); a++)
+    for (int b = int_min<B>(); b <= int_max<B>(); b++)
+      if (!check_operations<R>(static_cast<A>(a), static_cast<B>(b))) return;
+}
+
+/// Values around zero, the limits, and the square root of the maximum
+template <typename T>
+jtc::size_t edge_values(T* values) {
+  const exact_t max = int_max<T>(), min = int_min<T>();
+  const exact_t root = exact_t(1) << (sizeof(T) * 4 - (jtc::is_signed_v<T>() ? 1 : 0));
+  const exact_t candidates[] = {0,        1,        2,        3,        -1,       -2,      -3,      100,
+                                -100,     max,      max - 1,  max / 2,  max / 2 + 1, min, min + 1, min / 2,
+                                root - 1, root,     root + 1, -root + 1, -root,   -root - 1};
+  jtc::size_t size = 0;
+  for (exact_t candidate : candidates)
+    if (candidate >= min && candidate <= max) values[size++] = static_cast<T>(candidate);
+  return size;
+}
+
+template <typename R, typename A, typename B>
+void check_edges() {
+  A a[32];
+  B b[32];
+  const jtc::size_t a_size = edge_values(a), b_size = edge_values(b);
+  for (jtc::size_t i = 0; i < a_size; i++)
+    for (jtc::size_t j = 0; j < b_size; j++)
+      if (!check_operations<R>(a[i], b[j])) return;
+}
+
+}  // namespace
+
+int main() {
+  using namespace jtc;
+
+  check_exhaustive<int8_t, int8_t, int8_t>();
+  check_exhaustive<uint8_t, uint8_t, uint8_t>();
+  check_exhaustive<int8_t, uint8_t, int8_t>();
+  check_exhaustive<uint8_t, int8_t, uint8_t>();
+  check_exhaustive<uint8_t, int8_t, int8_t>();
+  check_exhaustive<int16_t, uint8_t, int8_t>();
+
+  check_edges<int16_t, int16_t, int16_t>();
+  check_edges<uint16_t, uint16_t, uint16_t>();
+  check_edges<int32_t, int32_t, int32_t>();
+  check_edges<uint32_t, uint32_t, uint32_t>();
+  check_edges<int64_t, int64_t, int64_t>();
+  check_edges<uint64_t, uint64_t, uint64_t>();
+
+  check_edges<int32_t, int32_t, uint32_t>();
+  check_edges<uint32_t, uint32_t, int32_t>();
+  check_edges<uint8_t, uint16_t, int16_t>();
+  check_edges<int64_t, int32_t, int32_t>();
+  check_edges<uint64_t, uint32_t, uint32_t>();
+  check_edges<int64_t, uint32_t, int32_t>();
+  check_edges<int64_t, int64_t, uint64_t>();
+  check_edges<uint64_t, uint64_t, int64_t>();
+
+  return tests::check_report("saturating");
+}
@@ -0,0 +1,198 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// simd.cpp: Runtime tests of simd.hpp
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// Every operator is compared with the same operation on each element, for the three implementations:
+//   vector extensions, register-sized vectors for wider types, and scalar code for other sizes.
+// Building with -DJTC_HAS_VECTOR_EXTENSIONS=0 runs all types through the scalar implementation.
+// The values are small integers, so floating-point results are exact in any order of evaluation.
+
+#include "check.hpp"
+#include "jtc/templates/simd.hpp"
+
+namespace {
+
+template <typename T, jtc::size_t N>
+struct operands {
+  alignas(jtc::simd<T, N>::alignment) T a[N];
+  alignas(jtc::simd<T, N>::alignment) T b[N];
+
+  // a alternates signs, if T is signed. b is never zero, and equal to a in exactly every third element.
+  operands() {
+    for (jtc::size_t i = 0; i < N; i++) {
+      const int magnitude = static_cast<int>(i % 11) + 1;
+      const T other = static_cast<T>(i % 5 + 1);
+      a[i] = static_cast<T>(jtc::is_signed_v<T>() && i % 2 == 1 ? -magnitude : magnitude);
+      b[i] = i % 3 == 0 ? a[i] : i % 3 == 1 ? static_cast<T>(a[i] * 2) : other != a[i] ? other : static_cast<T>(other + 1);
+    }
+  }
+};
+
+/// Whether each element of v is op(a[i], b[i])
+template <typename T, jtc::size_t N, typename Op>
+bool elementwise(const jtc::simd<T, N>& v, const T* a, const T* b, Op op) {
+  for (jtc::size_t i = 0; i < N; i++)
+    if (v[i] != static_cast<T>(op(a[i], b[i]))) return false;
+  return true;
+}
+
+template <typename T, jtc::size_t N, typename Op>
+bool elementwise(const jtc::simd_mask<T, N>& m, const T* a, const T* b, Op op) {
+  for (jtc::size_t i = 0; i < N; i++)
+    if (m[i] != op(a[i], b[i])) return false;
+  return true;
+}
+
+template <typename T, jtc::size_t N>
+void check_memory() {
+  using V = jtc::simd<T, N>;
+  operands<T, N> x;
+
+  const V loaded = V::load(x.a), aligned = V::load_aligned(x.a);
+  JTC_CHECK(elementwise(loaded, x.a, x.b, [](T a, T) { return a; }));
+  JTC_CHECK(elementwise(aligned, x.a, x.b, [](T a, T) { return a; }));
+
+  alignas(V::alignment) T stored[N];
+  loaded.store_aligned(stored);
+  JTC_CHECK(elementwise(V::load(stored), x.a, x.b, [](T a, T) { return a; }));
+
+  // An unaligned store, one element past an aligned address
+  T unaligned[N + 1];
+  loaded.store(unaligned + 1);
+  JTC_CHECK(elementwise(V::load(unaligned + 1), x.a, x.b, [](T a, T) { return a; }));
+
+  V v(T(7));
+  JTC_CHECK(elementwise(v, x.a, x.b, [](T, T) { return T(7); }));
+  v.set(N - 1, T(3));
+  JTC_CHECK(v[N - 1] == T(3) && (N == 1 || v[0] == T(7)));
+}
+
+template <typename T, jtc::size_t N>
+void check_arithmetic() {
+  using V = jtc::simd<T, N>;
+  operands<T, N> x;
+  const V a = V::load(x.a), b = V::load(x.b);
+
+  JTC_CHECK(elementwise(a + b, x.a, x.b, [](T a, T b) { return a + b; }));
+  JTC_CHECK(elementwise(a - b, x.a, x.b, [](T a, T b) { return a - b; }));
+  JTC_CHECK(elementwise(a * b, x.a, x.b, [](T a, T b) { return a * b; }));
+  JTC_CHECK(elementwise(a / b, x.a, x.b, [](T a, T b) { return a / b; }));
+  JTC_CHECK(elementwise(-a, x.a, x.b, [](T a, T) { return -a; }));
+  JTC_CHECK(elementwise(+a, x.a, x.b, [](T a, T) { return a; }));
+  JTC_CHECK(elementwise(a * T(2), x.a, x.b, [](T a, T) { return a * T(2); }));
+
+  V c = a;
+  c += b;
+  c *= b;
+  c -= a;
+  c /= b;
+  JTC_CHECK(elementwise(c, x.a, x.b, [](T a, T b) { return T(T(T(T(a + b) * b) - a) / b); }));
+}
+
+template <typename T, jtc::size_t N>
+void check_bitwise(jtc::true_type /* integral */) {
+  using V = jtc::simd<T, N>;
+  operands<T, N> x;
+  const V a = V::load(x.a), b = V::load(x.b);
+
+  JTC_CHECK(elementwise(a & b, x.a, x.b, [](T a, T b) { return a & b; }));
+  JTC_CHECK(elementwise(a | b, x.a, x.b, [](T a, T b) { return a | b; }));
+  JTC_CHECK(elementwise(a ^ b, x.a, x.b, [](T a, T b) { return a ^ b; }));
+  JTC_CHECK(elementwise(~a, x.a, x.b, [](T a, T) { return ~a; }));
+}
+
+template <typename T, jtc::size_t N>
+void check_bitwise(jtc::false_type) {}
+
+template <typename T, jtc::size_t N>
+void check_comparison() {
+  using V = jtc::simd<T, N>;
+  operands<T, N> x;
+  const V a = V::load(x.a), b = V::load(x.b);
+
+  JTC_CHECK(elementwise(a == b, x.a, x.b, [](T a, T b) { return a == b; }));
+  JTC_CHECK(elementwise(a != b, x.a, x.b, [](T a, T b) { return a != b; }));
+  JTC_CHECK(elementwise(a < b, x.a, x.b, [](T a, T b) { return a < b; }));
+  JTC_CHECK(elementwise(a <= b, x.a, x.b, [](T a, T b) { return a <= b; }));
+  JTC_CHECK(elementwise(a > b, x.a, x.b, [](T a, T b) { return a > b; }));
+  JTC_CHECK(elementwise(a >= b, x.a, x.b, [](T a, T b) { return a >= b; }));
+
+  JTC_CHECK(elementwise(a < b && a != b, x.a, x.b, [](T a, T b) { return a < b && a != b; }));
+  JTC_CHECK(elementwise(a < b || a == b, x.a, x.b, [](T a, T b) { return a < b || a == b; }));
+  JTC_CHECK(elementwise(!(a < b), x.a, x.b, [](T a, T b) { return !(a < b); }));
+
+  // Every third element is equal
+  jtc::size_t equal = 0;
+  for (jtc::size_t i = 0; i < N; i++) equal += x.a[i] == x.b[i] ? 1 : 0;
+  JTC_CHECK(popcount(a == b) == equal);
+  JTC_CHECK(any_of(a == b) && !none_of(a == b));
+  JTC_CHECK(all_of(a == b) == (N == 1));
+  JTC_CHECK(all_of(a == a) && none_of(a != a));
+
+  JTC_CHECK(elementwise(select(a < b, a, b), x.a, x.b, [](T a, T b) { return a < b ? a : b; }));
+  JTC_CHECK(elementwise(min(a, b), x.a, x.b, [](T a, T b) { return b < a ? b : a; }));
+  JTC_CHECK(elementwise(max(a, b), x.a, x.b, [](T a, T b) { return a < b ? b : a; }));
+}
+
+template <typename T, jtc::size_t N>
+void check_reductions() {
+  using V = jtc::simd<T, N>;
+  operands<T, N> x;
+  const V a = V::load(x.a), b = V::load(x.b);
+
+  // 2 where a == b, 1 elsewhere, so the product doesn't overflow
+  const V factors = select(a == b, V(T(2)), V(T(1)));
+
+  T sum = 0, product = 1, minimum = x.a[0], maximum = x.a[0];
+  for (jtc::size_t i = 0; i < N; i++) {
+    sum = static_cast<T>(sum + x.a[i]);
+    product = static_cast<T>(product * (x.a[i] == x.b[i] ? 2 : 1));
+    minimum = x.a[i] < minimum ? x.a[i] : minimum;
+    maximum = maximum < x.a[i] ? x.a[i] : maximum;
+  }
+  JTC_CHECK(reduce_add(a) == sum);
+  JTC_CHECK(reduce_mul(factors) == product);
+  JTC_CHECK(reduce_min(a) == minimum);
+  JTC_CHECK(reduce_max(a) == maximum);
+}
+
+template <typename T, jtc::size_t N>
+void check_simd() {
+  check_memory<T, N>();
+  check_arithmetic<T, N>();
+  check_bitwise<T, N>(jtc::bool_constant<jtc::is_integral_v<T>()>{});
+  check_comparison<T, N>();
+  check_reductions<T, N>();
+}
+
+}  // namespace
+
+int main() {
+  // Vector extensions, in one register or split into several
+  check_simd<int, 4>();
+  check_simd<int, 32>();
+  check_simd<unsigned char, 16>();
+  check_simd<unsigned char, 64>();
+  check_simd<short, 8>();
+  check_simd<long long, 8>();
+  check_simd<float, 8>();
+  check_simd<float, 64>();
+  check_simd<double, 2>();
+  check_simd<double, 16>();
+
+  // Scalar implementation
+  check_simd<int, 3>();
+  check_simd<unsigned, 5>();
+  check_simd<float, 7>();
+  check_simd<long double, 2>();
+  check_simd<int, 1>();
+
+  JTC_CHECK(jtc::simd<int, 4>::is_native == (JTC_HAS_VECTOR_EXTENSIONS != 0));
+  JTC_CHECK(jtc::simd<float, 64>::is_native == (JTC_HAS_VECTOR_EXTENSIONS != 0));
+  JTC_CHECK(!jtc::simd<int, 3>::is_native);
+
+  return jtc::tests::check_report("simd");
+}
@@ -0,0 +1,151 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// soa.cpp: Runtime tests of soa.hpp
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "check.hpp"
+#include "jtc/templates/soa.hpp"
+
+namespace {
+
+/// Counts live instances, to check construction and destruction of soa_vector records
+struct counted {
+  static int live;
+  int value;
+
+  counted() : value(0) { live++; }
+  counted(int v) : value(v) { live++; }
+  counted(const counted& other) : value(other.value) { live++; }
+  counted(counted&& other) noexcept : value(other.value) {
+    other.value = -1;
+    live++;
+  }
+  counted& operator=(const counted&) = default;
+  ~counted() { live--; }
+};
+
+int counted::live = 0;
+
+template <jtc::size_t I, typename Container>
+bool is_aligned(const Container& c) {
+  return reinterpret_cast<jtc::size_t>(c.template data<I>()) % Container::template alignment<I>() == 0;
+}
+
+void check_array() {
+  using particles = jtc::soa_array<jtc::type_list<float, double, char>, 10>;
+  particles p;
+
+  // get and set address the same elements
+  for (jtc::size_t i = 0; i < particles::size(); i++) p.set(i, float(i), double(i) * 2, char('a' + i));
+  JTC_CHECK(is_aligned<0>(p) && is_aligned<1>(p) && is_aligned<2>(p));
+  JTC_CHECK(p.field<0>().size() == 10 && p.field<0>().data() == p.data<0>());
+  JTC_CHECK(p.get<0>(3) == 3.0f && p.get<1>(3) == 6.0 && p.get<2>(3) == 'd');
+  p.get<1>(3) = -1.0;
+  JTC_CHECK(p.data<1>()[3] == -1.0 && p.field<1>()[3] == -1.0);
+
+  // Spans write through to the columns
+  jtc::span<float> x = p.field<0>();
+  for (jtc::size_t i = 0; i < x.size(); i++) x[i] += 0.5f;
+  JTC_CHECK(p.get<0>(0) == 0.5f && p.get<0>(9) == 9.5f);
+
+  // Row proxies: field access, and assignment copying the fields
+  particles::reference row = p[4];
+  JTC_CHECK(row.index() == 4 && row.get<0>() == 4.5f && jtc::get<2>(row) == 'e');
+  row.get<2>() = 'z';
+  JTC_CHECK(p.get<2>(4) == 'z');
+  row.set(1.0f, 2.0, 'x');
+  JTC_CHECK(p.get<0>(4) == 1.0f && p.get<1>(4) == 2.0 && p.get<2>(4) == 'x');
+
+  p[0] = p[4];
+  JTC_CHECK(p.get<0>(0) == 1.0f && p.get<1>(0) == 2.0 && p.get<2>(0) == 'x');
+  JTC_CHECK(row.index() == 4 && p[0].index() == 0);
+
+  // Between containers, and from a const container
+  particles q;
+  const particles& cp = p;
+  q[9] = cp[5];
+  JTC_CHECK(q.get<0>(9) == 5.5f && q.get<1>(9) == 10.0 && q.get<2>(9) == 'f');
+  JTC_CHECK(cp[5].get<1>() == 10.0 && cp.field<2>()[5] == 'f');
+}
+
+void check_vector() {
+  using records = jtc::soa_vector<jtc::type_list<int, counted, short>>;
+  {
+    records v;
+    JTC_CHECK(v.empty() && v.size() == 0 && v.capacity() == 0);
+
+    for (int i = 0; i < 20; i++) v.push_back(i, counted(i * 10), short(i));
+    JTC_CHECK(v.size() == 20 && v.capacity() >= 20 && counted::live == 20);
+    JTC_CHECK(is_aligned<0>(v) && is_aligned<1>(v) && is_aligned<2>(v));
+
+    // Values survive growth
+    bool values = true;
+    for (int i = 0; i < 20; i++) values = values && v.get<0>(i) == i && v.get<1>(i).value == i * 10 && v.get<2>(i) == i;
+    JTC_CHECK(values);
+
+    v.emplace_back(100, 1000, short(7));
+    JTC_CHECK(v.size() == 21 && v.back().get<1>().value == 1000 && counted::live == 21);
+
+    v.pop_back();
+    JTC_CHECK(v.size() == 20 && counted::live == 20 && v.back().get<0>() == 19);
+
+    v[0] = v[19];
+    JTC_CHECK(v.get<0>(0) == 19 && v.get<1>(0).value == 190 && v.get<2>(0) == 19);
+    JTC_CHECK(v.field<1>().size() == 20 && v.field<1>()[19].value == 190);
+
+    records copy(v);
+    JTC_CHECK(copy.size() == 20 && copy.get<1>(5).value == 50 && counted::live == 40);
+    copy.set(5, -5, counted(-50), short(-5));
+    JTC_CHECK(v.get<1>(5).value == 50 && copy.get<1>(5).value == -50);
+
+    records moved(jtc::move(copy));
+    JTC_CHECK(moved.size() == 20 && copy.size() == 0 && counted::live == 40);
+
+    moved.resize(25);
+    JTC_CHECK(moved.size() == 25 && moved.get<1>(24).value == 0 && counted::live == 45);
+    moved.resize(3);
+    JTC_CHECK(moved.size() == 3 && counted::live == 23);
+
+    const jtc::size_t capacity = v.capacity();
+    v.clear();
+    JTC_CHECK(v.empty() && v.capacity() == capacity && counted::live == 3);
+
+    v.reserve(100);
+    JTC_CHECK(v.capacity() >= 100 && v.empty());
+  }
+  JTC_CHECK(counted::live == 0);
+
+  // Appending the vector's own records, including when it's full and has to grow (at 8, 16 and 32 records):
+  //   the new record must be constructed before the old block is freed
+  {
+    records v;
+    int expected[64];
+    for (int i = 0; i < 8; i++) {
+      v.push_back(i, counted(i * 10), short(i));
+      expected[i] = i;
+    }
+    for (int i = 8; i < 64; i++) {
+      const int k = i / 2;
+      if (i % 2 == 0) v.push_back(v.get<0>(k), v.get<1>(k), v.get<2>(k));
+      else v.emplace_back(v.get<0>(k), v.get<1>(k), v.get<2>(k));
+      expected[i] = expected[k];
+    }
+    bool values = true;
+    for (int i = 0; i < 64; i++) {
+      const int e = expected[i];
+      values = values && v.get<0>(i) == e && v.get<1>(i).value == e * 10 && v.get<2>(i) == e;
+    }
+    JTC_CHECK(values && v.size() == 64 && counted::live == 64);
+  }
+  JTC_CHECK(counted::live == 0);
+}
+
+}  // namespace
+
+int main() {
+  check_array();
+  check_vector();
+  return jtc::tests::check_report("soa");
+}
@@ -0,0 +1,88 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// sort_network.cpp: Runtime tests of sort_network.hpp
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "check.hpp"
+#include "jtc/templates/integer_sequence.hpp"
+#include "jtc/templates/sort_network.hpp"
+
+namespace {
+
+/// Insertion sort, the reference
+template <typename T>
+void reference_sort(T* data, jtc::size_t size) {
+  for (jtc::size_t i = 1; i < size; i++) {
+    const T value = data[i];
+    jtc::size_t j = i;
+    for (; j > 0 && data[j - 1] > value; j--) data[j] = data[j - 1];
+    data[j] = value;
+  }
+}
+
+/// Small linear congruential generator, so the inputs are the same on every run
+unsigned next_random() {
+  static unsigned state = 12345;
+  state = state * 1103515245u + 12345u;
+  return state >> 16;
+}
+
+/// Sorts random inputs of N elements, drawn from 'range' values: small ranges have many duplicates
+template <jtc::size_t N, typename T>
+bool check_size(unsigned range) {
+  for (int round = 0; round < 200; round++) {
+    // One extra element on each side, to detect writes out of bounds
+    T data[N + 2], expected[N + 2];
+    for (jtc::size_t i = 0; i < N + 2; i++) data[i] = expected[i] = static_cast<T>(next_random() % range) - T(range / 2);
+    reference_sort(expected + 1, N);
+    jtc::sort_network<N>::sort(data + 1);
+    for (jtc::size_t i = 0; i < N + 2; i++)
+      if (!JTC_CHECK(data[i] == expected[i])) return false;
+  }
+  return true;
+}
+
+template <jtc::size_t N>
+void check_network() {
+  check_size<N, int>(1000000);
+  check_size<N, int>(3);
+  check_size<N, double>(2);
+  check_size<N, unsigned char>(256);
+
+  // Already sorted, reversed and constant
+  int data[N + 1], reversed[N + 1], constant[N + 1];
+  for (jtc::size_t i = 0; i < N; i++) {
+    data[i] = static_cast<int>(i);
+    reversed[i] = static_cast<int>(N - i);
+    constant[i] = 7;
+  }
+  jtc::sort_network<N>::sort(data);
+  jtc::sort_network<N>::sort(reversed);
+  jtc::sort_network<N>::sort(constant);
+  for (jtc::size_t i = 0; i < N; i++) {
+    if (!JTC_CHECK(data[i] == static_cast<int>(i) && reversed[i] == static_cast<int>(i + 1) && constant[i] == 7))
+      return;
+  }
+}
+
+template <jtc::size_t... Ns>
+void check_networks(jtc::index_sequence<Ns...>) {
+  using expand = int[];
+  (void)expand{0, (check_network<Ns>(), 0)...};
+}
+
+}  // namespace
+
+int main() {
+  check_networks(jtc::make_index_sequence<33>{});
+
+  // network_sort deduces N from the array
+  int one[1] = {5};
+  jtc::network_sort(one);
+  float nine[9] = {7, 3, 9, 1, 5, 8, 2, 6, 4};
+  jtc::network_sort(nine);
+  JTC_CHECK(one[0] == 5 && nine[0] == 1 && nine[4] == 5 && nine[8] == 9);
+  return jtc::tests::check_report("sort_network");
+}
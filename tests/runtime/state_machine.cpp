@@ -0,0 +1,105 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// state_machine.cpp: Runtime tests of state_machine.hpp
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "check.hpp"
+#include "jtc/templates/state_machine.hpp"
+
+namespace {
+
+struct idle {}; struct connecting {}; struct online {};
+struct dial { int number; };
+struct ack {};
+struct hang_up {};
+
+/// Records the actions called, in order
+struct modem {
+  int calls = 0;
+  int dialed = 0;
+  int log[8] = {};
+};
+
+struct on_dial {
+  void operator()(modem& m, const dial& event) const {
+    m.dialed = event.number;
+    m.log[m.calls++] = 1;
+  }
+};
+struct on_online {
+  void operator()(modem& m, const ack&) const { m.log[m.calls++] = 2; }
+};
+struct on_hang_up {
+  void operator()(modem& m, const hang_up&) const { m.log[m.calls++] = 3; }
+};
+
+using modem_fsm = jtc::state_machine<modem, jtc::type_list<jtc::transition<idle, dial, connecting, on_dial>,
+                                                           jtc::transition<connecting, ack, online, on_online>,
+                                                           jtc::transition<connecting, hang_up, idle, on_hang_up>,
+                                                           jtc::transition<online, hang_up, idle, on_hang_up>>>;
+
+void check_transitions() {
+  modem m;
+  modem_fsm fsm;
+  JTC_CHECK(fsm.is_in<idle>() && fsm.state_tag().is<idle>());
+
+  // Each action runs once, with the context and the event of its transition
+  JTC_CHECK(fsm.process(m, dial{42}) && fsm.is_in<connecting>());
+  JTC_CHECK(m.calls == 1 && m.log[0] == 1 && m.dialed == 42);
+  JTC_CHECK(fsm.process(m, ack{}) && fsm.is_in<online>() && fsm.state_tag().is<online>());
+  JTC_CHECK(m.calls == 2 && m.log[1] == 2);
+  JTC_CHECK(fsm.process(m, hang_up{}) && fsm.is_in<idle>());
+  JTC_CHECK(m.calls == 3 && m.log[2] == 3);
+
+  // The same event leads to different states, depending on the current one
+  fsm.process(m, dial{7});
+  JTC_CHECK(fsm.process(m, hang_up{}) && fsm.is_in<idle>() && m.calls == 5 && m.log[4] == 3 && m.dialed == 7);
+
+  // A machine can start in any state
+  modem_fsm started = modem_fsm::starting_at<online>();
+  JTC_CHECK(started.is_in<online>() && started.process(m, hang_up{}) && started.is_in<idle>());
+}
+
+void check_unhandled() {
+  modem m;
+  modem_fsm fsm;
+
+  // Unhandled events return false, keep the state and call no action
+  JTC_CHECK(!fsm.process(m, ack{}) && !fsm.process(m, hang_up{}) && fsm.is_in<idle>() && m.calls == 0);
+  fsm.process(m, dial{1});
+  JTC_CHECK(!fsm.process(m, dial{2}) && fsm.is_in<connecting>() && m.calls == 1 && m.dialed == 1);
+  fsm.process(m, ack{});
+  JTC_CHECK(!fsm.process(m, ack{}) && !fsm.process(m, dial{3}) && fsm.is_in<online>() && m.calls == 2);
+  JTC_CHECK(modem_fsm::unhandled_count() == 5 && !modem_fsm::is_complete());
+}
+
+/// A complete machine: every state handles every event
+struct toggle {};
+struct on {}; struct off {};
+struct count_toggles {
+  void operator()(int& count, const toggle&) const { count++; }
+};
+
+using switch_fsm = jtc::state_machine<int,
+                                      jtc::type_list<jtc::transition<off, toggle, on, count_toggles>,
+                                                     jtc::transition<on, toggle, off, count_toggles>>,
+                                      jtc::fsm_require_complete>;
+
+void check_complete() {
+  int count = 0;
+  switch_fsm fsm;
+  JTC_CHECK(switch_fsm::is_complete() && fsm.is_in<off>());
+  for (int i = 0; i < 5; i++) JTC_CHECK(fsm.process(count, toggle{}));
+  JTC_CHECK(fsm.is_in<on>() && count == 5);
+}
+
+}  // namespace
+
+int main() {
+  check_transitions();
+  check_unhandled();
+  check_complete();
+  return jtc::tests::check_report("state_machine");
+}
@@ -0,0 +1,144 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// trace.cpp: Runtime tests of trace.hpp
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// A small ring and probe limit, so the tests can fill them
+#define JTC_TRACE
+#define JTC_TRACE_CAPACITY 16
+#define JTC_TRACE_MAX_PROBES 4
+
+#include "check.hpp"
+#include "jtc/templates/trace.hpp"
+
+namespace {
+
+namespace trace = jtc::trace;
+
+constexpr trace::probe_info probes[] = {{"parse"}, {"filter"}, {"send"}, {"log"}, {"overflow"}};
+
+unsigned char buffer[4096];
+
+bool name_is(const trace::profile<>& p, jtc::size_t i, const char* text) {
+  jtc::size_t size = 0;
+  while (text[size] != '\0') size++;
+  if (p.name_size(i) != size) return false;
+  for (jtc::size_t c = 0; c < size; c++)
+    if (p.name(i)[c] != text[c]) return false;
+  return true;
+}
+
+/// Empties the calling thread's ring
+void reset_ring() { trace::this_thread_ring() = trace::ring(); }
+
+void nested() {
+  JTC_TRACE_SCOPE("outer");
+  for (int i = 0; i < 3; i++) {
+    JTC_TRACE_SCOPE("inner");
+  }
+}
+
+void check_round_trip() {
+  reset_ring();
+
+  // Probes record their scopes, in order of completion: the inner scopes end first
+  nested();
+  JTC_CHECK(trace::this_thread_ring().size() == 4);
+  JTC_CHECK(trace::this_thread_ring()[3].duration >= trace::this_thread_ring()[0].duration);
+
+  // Known durations, and starts going back in time, which are encoded as negative deltas
+  trace::ring& ring = trace::this_thread_ring();
+  const jtc::uint64_t base = ring[3].start;
+  ring.push(&probes[0], base + 1000, 7);
+  ring.push(&probes[1], base + 10, 300);
+  ring.push(&probes[0], base + 5000, 9);
+
+  const jtc::size_t size = trace::dump(buffer, sizeof(buffer));
+  trace::profile<> p;
+  if (!JTC_CHECK(size > 0 && p.decode(buffer, size))) return;
+
+  JTC_CHECK(p.source() == trace::source() && p.frequency() == trace::frequency());
+  JTC_CHECK(p.probe_count() == 4 && name_is(p, 0, "inner") && name_is(p, 1, "outer"));
+  JTC_CHECK(name_is(p, 2, "parse") && name_is(p, 3, "filter"));
+  JTC_CHECK(p.durations(0).count == 3 && p.durations(1).count == 1);
+  JTC_CHECK(p.durations(2).count == 2 && p.durations(2).total == 16 && p.durations(2).min == 7);
+  JTC_CHECK(p.durations(2).max == 9 && p.durations(2).mean() == 8);
+  JTC_CHECK(p.durations(3).count == 1 && p.durations(3).max == 300);
+
+  // Truncated or corrupted data is rejected
+  JTC_CHECK(!p.decode(buffer, size - 1) && !p.decode(buffer, 5));
+  buffer[4]++;
+  JTC_CHECK(!p.decode(buffer, size));
+  buffer[4]--;
+  JTC_CHECK(p.decode(buffer, size) && p.probe_count() == 4);
+}
+
+void check_undersized_buffer() {
+  reset_ring();
+  for (int i = 0; i < 10; i++) trace::this_thread_ring().push(&probes[i % 3], 100u * i, 1000u * i);
+  const jtc::size_t size = trace::dump(buffer, sizeof(buffer));
+  if (!JTC_CHECK(size > 0)) return;
+
+  // Every smaller buffer fails, without writing past its end
+  unsigned char small[sizeof(buffer)];
+  for (jtc::size_t capacity = 0; capacity < size; capacity++) {
+    for (jtc::size_t i = 0; i < sizeof(small); i++) small[i] = 0xA5;
+    if (!JTC_CHECK(trace::dump(small, capacity) == 0)) return;
+    for (jtc::size_t i = capacity; i < sizeof(small); i++)
+      if (!JTC_CHECK(small[i] == 0xA5)) return;
+  }
+}
+
+void check_wrap_around() {
+  reset_ring();
+
+  // Only the last JTC_TRACE_CAPACITY events are kept
+  for (jtc::uint64_t i = 0; i < 40; i++) trace::this_thread_ring().push(&probes[i % 2], 10 * i, i);
+  JTC_CHECK(trace::this_thread_ring().size() == 16 && trace::this_thread_ring()[0].duration == 24);
+
+  const jtc::size_t size = trace::dump(buffer, sizeof(buffer));
+  trace::profile<> p;
+  if (!JTC_CHECK(size > 0 && p.decode(buffer, size))) return;
+  JTC_CHECK(p.probe_count() == 2 && name_is(p, 0, "parse"));
+  JTC_CHECK(p.durations(0).count == 8 && p.durations(0).min == 24 && p.durations(0).max == 38);
+  JTC_CHECK(p.durations(1).count == 8 && p.durations(1).min == 25 && p.durations(1).max == 39);
+
+  // Events of probes beyond JTC_TRACE_MAX_PROBES are skipped
+  reset_ring();
+  for (int i = 0; i < 10; i++) trace::this_thread_ring().push(&probes[i % 5], 0, 1);
+  p.decode(buffer, trace::dump(buffer, sizeof(buffer)));
+  JTC_CHECK(p.probe_count() == 4 && name_is(p, 3, "log") && p.durations(0).count == 2 && p.durations(3).count == 2);
+}
+
+void check_percentile() {
+  trace::histogram h = trace::histogram();
+  JTC_CHECK(h.percentile(50) == 0 && h.mean() == 0);
+
+  // Bucket bounds never exceed the largest duration
+  h.add(32);
+  JTC_CHECK(h.percentile(0) == 32 && h.percentile(50) == 32 && h.percentile(100) == 32);
+
+  // 90 durations of 5 (bucket [4, 8)) and 10 of 1000 (bucket [512, 1024))
+  h = trace::histogram();
+  for (int i = 0; i < 90; i++) h.add(5);
+  for (int i = 0; i < 10; i++) h.add(1000);
+  JTC_CHECK(h.percentile(50) == 7 && h.percentile(90) == 7 && h.percentile(91) == 1000 && h.percentile(100) == 1000);
+  JTC_CHECK(h.min == 5 && h.max == 1000 && h.count == 100 && h.mean() == 104);
+
+  h = trace::histogram();
+  h.add(0);
+  h.add(~jtc::uint64_t(0));
+  JTC_CHECK(h.percentile(50) == 0 && h.percentile(100) == ~jtc::uint64_t(0));
+}
+
+}  // namespace
+
+int main() {
+  check_round_trip();
+  check_undersized_buffer();
+  check_wrap_around();
+  check_percentile();
+  return jtc::tests::check_report("trace");
+}
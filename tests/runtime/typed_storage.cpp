@@ -0,0 +1,158 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// typed_storage.cpp: Runtime tests of typed_storage.hpp
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "check.hpp"
+#include "jtc/templates/typed_storage.hpp"
+
+namespace {
+
+/// Counts live instances. Constructing from a negative value throws.
+struct counted {
+  static int live;
+  static int constructions;
+  int value;
+
+  counted() : counted(0) {}
+  explicit counted(int value_) : value(value_) {
+    if (value_ < 0) throw value_;
+    live++;
+    constructions++;
+  }
+  counted(const counted& other) : counted(other.value) {}
+  ~counted() { live--; }
+};
+
+int counted::live = 0;
+int counted::constructions = 0;
+
+struct sensor {};
+struct radio {};
+struct logger {
+  virtual ~logger() {}
+  virtual int level() const = 0;
+};
+struct uart_logger : logger {
+  int level() const override { return 3; }
+};
+
+using storage = jtc::typed_storage<int, jtc::map_node<sensor, counted>, jtc::map_node<radio, jtc::lazy<counted>>,
+                                   jtc::map_node<logger, uart_logger>>;
+
+void check_access() {
+  {
+    storage s;
+    // Eager values are value-initialized with the storage, lazy ones aren't constructed yet
+    JTC_CHECK(s.get<int>() == 0 && s.get<sensor>().value == 0 && counted::live == 1);
+    JTC_CHECK(s.has_value<int>() && s.has_value<sensor>() && !s.has_value<radio>());
+    JTC_CHECK(s.get<logger>().level() == 3);
+
+    // Lazy values are constructed on the first access, even through a const storage, and only once
+    const storage& cs = s;
+    JTC_CHECK(cs.get<radio>().value == 0 && s.has_value<radio>() && counted::live == 2);
+    s.get<radio>().value = 4;
+    JTC_CHECK(cs.get<radio>().value == 4 && counted::live == 2);
+
+    // Keys holding the same type are distinct values
+    s.get<sensor>().value = 9;
+    JTC_CHECK(s.get<radio>().value == 4 && &s.get<sensor>() != &s.get<radio>());
+  }
+  JTC_CHECK(counted::live == 0);
+}
+
+void check_emplace_reset() {
+  {
+    storage s;
+    counted& sensor_value = s.emplace<sensor>(5);
+    JTC_CHECK(sensor_value.value == 5 && &sensor_value == &s.get<sensor>() && counted::live == 1);
+
+    // Emplacing a lazy value constructs it, with no default construction first
+    counted::constructions = 0;
+    counted& radio_value = s.emplace<radio>(6);
+    JTC_CHECK(radio_value.value == 6 && counted::live == 2 && counted::constructions == 1);
+    s.emplace<radio>(7);
+    JTC_CHECK(s.get<radio>().value == 7 && counted::live == 2);
+
+    // The argument may be the value being replaced
+    s.emplace<sensor>(s.get<sensor>());
+    JTC_CHECK(s.get<sensor>().value == 5 && counted::live == 2);
+
+    s.reset<radio>();
+    JTC_CHECK(!s.has_value<radio>() && counted::live == 1);
+    s.reset<radio>();
+    JTC_CHECK(!s.has_value<radio>() && counted::live == 1);
+    JTC_CHECK(s.get<radio>().value == 0 && counted::live == 2);
+
+    s.emplace<int>(12);
+    JTC_CHECK(s.get<int>() == 12);
+  }
+  JTC_CHECK(counted::live == 0);
+}
+
+void check_throwing_emplace() {
+  {
+    storage s;
+    s.emplace<sensor>(1);
+    s.emplace<radio>(2);
+
+    // An eager value keeps its previous value
+    bool thrown = false;
+    try {
+      s.emplace<sensor>(-1);
+    } catch (int) {
+      thrown = true;
+    }
+    JTC_CHECK(thrown && s.get<sensor>().value == 1 && counted::live == 2);
+
+    // A lazy value is left empty, and constructed again on the next access
+    thrown = false;
+    try {
+      s.emplace<radio>(-1);
+    } catch (int) {
+      thrown = true;
+    }
+    JTC_CHECK(thrown && !s.has_value<radio>() && counted::live == 1);
+    JTC_CHECK(s.get<radio>().value == 0 && counted::live == 2);
+  }
+  JTC_CHECK(counted::live == 0);
+}
+
+void check_copy() {
+  {
+    storage a;
+    a.emplace<sensor>(3);
+
+    // Lazy values are copied only if constructed
+    storage b(a);
+    JTC_CHECK(b.get<sensor>().value == 3 && !b.has_value<radio>() && counted::live == 2);
+
+    a.emplace<radio>(8);
+    storage c(a);
+    JTC_CHECK(c.has_value<radio>() && c.get<radio>().value == 8 && counted::live == 5);
+    c.get<radio>().value = 9;
+    JTC_CHECK(a.get<radio>().value == 8);
+
+    // Assignment replaces the lazy value, or destroys it
+    b = c;
+    JTC_CHECK(b.get<radio>().value == 9 && b.get<sensor>().value == 3 && counted::live == 6);
+    c.reset<radio>();
+    b = c;
+    JTC_CHECK(!b.has_value<radio>() && counted::live == 4);
+    b = b;
+    JTC_CHECK(!b.has_value<radio>() && b.get<sensor>().value == 3 && counted::live == 4);
+  }
+  JTC_CHECK(counted::live == 0);
+}
+
+}  // namespace
+
+int main() {
+  check_access();
+  check_emplace_reset();
+  check_throwing_emplace();
+  check_copy();
+  return jtc::tests::check_report("typed_storage");
+}
@@ -0,0 +1,128 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// varint.cpp: Runtime tests of varint.hpp
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "check.hpp"
+#include "jtc/templates/varint.hpp"
+
+namespace {
+
+/// Encodes value, then checks its size, both decoders, and that every shorter input is rejected as truncated
+template <typename T>
+bool check_round_trip(T value) {
+  unsigned char buffer[jtc::varint_max_size<T>()];
+  const unsigned char* end = jtc::varint_encode(value, buffer);
+  const jtc::size_t size = static_cast<jtc::size_t>(end - buffer);
+  if (!JTC_CHECK(size == jtc::varint_size(value) && size <= jtc::varint_max_size<T>())) return false;
+
+  T decoded = 0, unchecked = 0;
+  if (!JTC_CHECK(jtc::varint_decode(buffer, end, decoded) == end && decoded == value)) return false;
+  if (!JTC_CHECK(jtc::varint_decode_unchecked(buffer, unchecked) == end && unchecked == value)) return false;
+
+  for (jtc::size_t length = 0; length < size; length++) {
+    T partial;
+    if (!JTC_CHECK(jtc::varint_decode(buffer, buffer + length, partial) == nullptr)) return false;
+  }
+  return true;
+}
+
+/// Zero, powers of two and their neighbours, which change the encoded size at multiples of 7 bits, and the limits
+template <typename T>
+void check_values() {
+  using U = jtc::make_unsigned_t<T>;
+  check_round_trip(T(0));
+  for (unsigned bit = 0; bit < sizeof(T) * 8; bit++) {
+    const U power = static_cast<U>(U(1) << bit);
+    if (!check_round_trip(static_cast<T>(power)) || !check_round_trip(static_cast<T>(power - 1)) ||
+        !check_round_trip(static_cast<T>(power + 1)) || !check_round_trip(static_cast<T>(static_cast<U>(U(0) - power))))
+      return;
+  }
+  check_round_trip(static_cast<T>(~U(0)));
+  check_round_trip(static_cast<T>(~U(0) >> 1));
+}
+
+template <jtc::size_t N>
+bool bytes_equal(const unsigned char* begin, const unsigned char* end, const unsigned char (&expected)[N]) {
+  if (static_cast<jtc::size_t>(end - begin) != N) return false;
+  for (jtc::size_t i = 0; i < N; i++)
+    if (begin[i] != expected[i]) return false;
+  return true;
+}
+
+void check_encoding() {
+  unsigned char buffer[jtc::varint_max_size<jtc::uint64_t>()];
+
+  const unsigned char three_hundred[] = {0xAC, 0x02};
+  JTC_CHECK(bytes_equal(buffer, jtc::varint_encode(jtc::uint32_t(300), buffer), three_hundred));
+
+  const unsigned char minus_three[] = {0x05};
+  JTC_CHECK(bytes_equal(buffer, jtc::varint_encode(jtc::int16_t(-3), buffer), minus_three));
+
+  const unsigned char max64[] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01};
+  JTC_CHECK(bytes_equal(buffer, jtc::varint_encode(~jtc::uint64_t(0), buffer), max64));
+}
+
+void check_errors() {
+  // Longer than varint_max_size: the last byte has the continuation bit
+  const unsigned char long64[] = {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00};
+  jtc::uint64_t value64;
+  JTC_CHECK(jtc::varint_decode(long64, long64 + sizeof(long64), value64) == nullptr);
+  JTC_CHECK(jtc::varint_decode_unchecked(long64, value64) == nullptr);
+
+  const unsigned char long8[] = {0xFF, 0x81, 0x00};
+  jtc::uint8_t value8;
+  jtc::int8_t signed8;
+  JTC_CHECK(jtc::varint_decode(long8, long8 + sizeof(long8), value8) == nullptr);
+  JTC_CHECK(jtc::varint_decode(long8, long8 + sizeof(long8), signed8) == nullptr);
+
+  // Within varint_max_size, bits beyond the width of T are discarded
+  const unsigned char wide8[] = {0xFF, 0x7F};
+  JTC_CHECK(jtc::varint_decode(wide8, wide8 + sizeof(wide8), value8) == wide8 + 2 && value8 == 0xFF);
+
+  // Empty input
+  JTC_CHECK(jtc::varint_decode(long8, long8, value8) == nullptr);
+}
+
+void check_batches() {
+  jtc::int32_t values[100], decoded[101];
+  for (int i = 0; i < 100; i++) values[i] = (i % 2 == 0 ? 1 : -1) * (i * i * i * 1000 + i);
+
+  unsigned char buffer[100 * jtc::varint_max_size<jtc::int32_t>()];
+  const unsigned char* end = jtc::varint_encode_n(values, 100, buffer);
+  JTC_CHECK(jtc::varint_decode_n(buffer, end, decoded, 100) == end);
+
+  bool equal = true;
+  for (int i = 0; i < 100; i++) equal = equal && decoded[i] == values[i];
+  JTC_CHECK(equal);
+
+  // Truncated: the last value is missing its final byte
+  JTC_CHECK(jtc::varint_decode_n(buffer, end - 1, decoded, 100) == nullptr);
+  // Fewer values than requested
+  JTC_CHECK(jtc::varint_decode_n(buffer, end, decoded, 101) == nullptr);
+
+  // An over-long value in the middle of a batch, decoded on the unchecked path
+  unsigned char* middle = buffer + 20;
+  for (int i = 0; i < 5; i++) middle[i] = 0x80;
+  JTC_CHECK(jtc::varint_decode_n(buffer, end, decoded, 100) == nullptr);
+}
+
+}  // namespace
+
+int main() {
+  check_values<jtc::uint8_t>();
+  check_values<jtc::uint16_t>();
+  check_values<jtc::uint32_t>();
+  check_values<jtc::uint64_t>();
+  check_values<jtc::int8_t>();
+  check_values<jtc::int16_t>();
+  check_values<jtc::int32_t>();
+  check_values<jtc::int64_t>();
+
+  check_encoding();
+  check_errors();
+  check_batches();
+  return jtc::tests::check_report("varint");
+}
@@ -0,0 +1,94 @@
+// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+// wire_struct.cpp: Runtime tests of endian.hpp's loads and stores, and of wire_struct.hpp
+
+// Copyright Joel P. C. Filho 2019 - 2019
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "check.hpp"
+#include "jtc/templates/wire_struct.hpp"
+
+namespace {
+
+template <jtc::size_t N>
+bool bytes_equal(const unsigned char* data, const unsigned char (&expected)[N]) {
+  for (jtc::size_t i = 0; i < N; i++)
+    if (data[i] != expected[i]) return false;
+  return true;
+}
+
+void check_endian() {
+  // Stored bytes are in the requested order, at any alignment
+  unsigned char buffer[16] = {};
+  jtc::store_endian<jtc::endian::big>(buffer + 1, jtc::uint32_t(0x12345678));
+  const unsigned char big[] = {0, 0x12, 0x34, 0x56, 0x78, 0};
+  JTC_CHECK(bytes_equal(buffer, big));
+
+  jtc::store_endian<jtc::endian::little>(buffer + 3, jtc::uint16_t(0xCAFE));
+  const unsigned char little[] = {0, 0x12, 0x34, 0xFE, 0xCA, 0};
+  JTC_CHECK(bytes_equal(buffer, little));
+
+  // Loads read them back, and the other order reads them swapped
+  JTC_CHECK(jtc::load_endian<jtc::uint16_t, jtc::endian::little>(buffer + 3) == 0xCAFE);
+  JTC_CHECK(jtc::load_endian<jtc::uint16_t, jtc::endian::big>(buffer + 3) == 0xFECA);
+  JTC_CHECK(jtc::load_endian<jtc::uint32_t, jtc::endian::big>(buffer + 1) == 0x1234FECA);
+
+  jtc::store_endian<jtc::endian::big>(buffer + 5, jtc::int64_t(-2));
+  JTC_CHECK(buffer[5] == 0xFF && buffer[12] == 0xFE);
+  JTC_CHECK(jtc::load_endian<jtc::int64_t, jtc::endian::big>(buffer + 5) == -2);
+  JTC_CHECK(jtc::load_endian<jtc::int64_t, jtc::endian::native>(buffer + 5) ==
+            (jtc::endian::native == jtc::endian::big ? -2 : jtc::byteswap(jtc::int64_t(-2))));
+}
+
+using header_fields = jtc::type_list<jtc::wire_field<jtc::uint8_t>,
+                                     jtc::wire_field<jtc::uint16_t, jtc::endian::big>,
+                                     jtc::wire_field<jtc::int32_t, jtc::endian::little>,
+                                     jtc::wire_field<jtc::uint64_t>>;
+using header = jtc::wire_struct<header_fields>;
+using header_view = jtc::wire_struct<header_fields, const unsigned char>;
+
+void check_wire_struct() {
+  unsigned char buffer[header::size() * 2 + 1] = {};
+
+  // Records at an odd offset, so every multi-byte field is misaligned
+  header h(buffer + 1);
+  h.set<0>(0xAB);
+  h.set<1>(0x1234);
+  h.set<2>(-100000);
+  h.set<3>(0x0102030405060708u);
+
+  JTC_CHECK(h.get<0>() == 0xAB && h.get<1>() == 0x1234 && h.get<2>() == -100000 && h.get<3>() == 0x0102030405060708u);
+
+  // The bytes follow the layout, each field in its byte order
+  const unsigned char expected[] = {0,    0xAB, 0x12, 0x34, 0x60, 0x79, 0xFE, 0xFF,
+                                    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+  JTC_CHECK(bytes_equal(buffer, expected));
+
+  // Fields are independent
+  h.set<1>(0xFFFF);
+  JTC_CHECK(h.get<0>() == 0xAB && h.get<1>() == 0xFFFF && h.get<2>() == -100000);
+
+  // Limits round-trip
+  h.set<2>(jtc::int32_t(-2147483647 - 1));
+  h.set<3>(~jtc::uint64_t(0));
+  JTC_CHECK(h.get<2>() == jtc::int32_t(-2147483647 - 1) && h.get<3>() == ~jtc::uint64_t(0));
+
+  // Arrays of records, and read-only views of the same bytes
+  header second = h.next();
+  JTC_CHECK(second.data() == buffer + 1 + header::size());
+  second.set<1>(0xBEEF);
+  second.set<3>(42);
+
+  header_view view(buffer + 1);
+  JTC_CHECK(view.get<0>() == 0xAB && view.get<2>() == jtc::int32_t(-2147483647 - 1));
+  JTC_CHECK(view.next().get<1>() == 0xBEEF && view.next().get<3>() == 42);
+  JTC_CHECK(h.get<3>() == ~jtc::uint64_t(0));
+}
+
+}  // namespace
+
+int main() {
+  check_endian();
+  check_wire_struct();
+  return jtc::tests::check_report("wire_struct");
+}
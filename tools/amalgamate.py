@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+# Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC
+# amalgamate.py: Generates single-header versions of the collection, or of a subset of it
+
+# Copyright Joel P. C. Filho 2019 - 2019
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+"""Generates a single header from JTC headers and their dependencies.
+
+Starting from the given headers, every quoted #include is replaced by the contents of the included
+header, the first time it's included, like the preprocessor would do. So a subset only contains the
+headers it transitively depends on, in an order that compiles.
+
+Each header's include guard is removed, and its macro defined once at the top of the output instead.
+Headers included after the single header are then skipped. System headers (<...>) are kept as-is.
+
+Usage, from the repository root:
+    tools/amalgamate.py                                  # jtc_single.hpp, the whole collection
+    tools/amalgamate.py type_list -o jtc_type_list.hpp   # type_list.hpp and its dependencies
+    tools/amalgamate.py utility.hpp span --no-tests      # Two headers, without the JTC_TESTS blocks
+    tools/amalgamate.py varint --list                    # Only print the dependencies
+"""
+
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'include', 'jtc'))
+
+INCLUDE = re.compile(r'^\s*#\s*include\s+"([^"]+)"')
+IFNDEF = re.compile(r'^\s*#\s*ifndef\s+(\w+)')
+DEFINE = re.compile(r'^\s*#\s*define\s+(\w+)\s*$')
+CONDITIONAL = re.compile(r'^\s*#\s*if')
+ENDIF = re.compile(r'^\s*#\s*endif')
+TESTS = re.compile(r'^\s*#\s*ifdef\s+JTC_TESTS\b')
+BANNER = '//' + '-' * 97
+
+
+def resolve(name):
+    """Path of a header given as 'type_list', 'type_list.hpp', 'templates/type_list.hpp' or 'utility.hpp'."""
+    if not name.endswith('.hpp'):
+        name += '.hpp'
+    for candidate in (os.path.join(ROOT, name), os.path.join(ROOT, 'templates', name)):
+        if os.path.isfile(candidate):
+            return os.path.normpath(candidate)
+    sys.exit('amalgamate.py: no header named {} in {}'.format(name, ROOT))
+
+
+def split_header(lines):
+    """Splits a header into its description, include guard macro, and body without the guard."""
+    guard_line = next(i for i, line in enumerate(lines) if IFNDEF.match(line))
+    guard = IFNDEF.match(lines[guard_line]).group(1)
+    if not DEFINE.match(lines[guard_line + 1]) or DEFINE.match(lines[guard_line + 1]).group(1) != guard:
+        raise ValueError('include guard {} is not followed by its #define'.format(guard))
+    end = max(i for i, line in enumerate(lines) if ENDIF.match(line))
+
+    # The leading comment, without the project line and the license
+    description = []
+    for line in lines[:guard_line]:
+        if not line.startswith('//') or "Joel's Template Collection" in line:
+            continue
+        if 'Copyright' in line or 'Boost Software License' in line or 'LICENSE' in line:
+            continue
+        description.append(line)
+
+    return description, guard, lines[guard_line + 2:end]
+
+
+def strip_tests(lines):
+    """Removes the JTC_TESTS blocks, and the 'Compile-time Tests' banner before each of them."""
+    result = []
+    i = 0
+    while i < len(lines):
+        if not TESTS.match(lines[i]):
+            result.append(lines[i])
+            i += 1
+            continue
+
+        depth = 0
+        while True:
+            if CONDITIONAL.match(lines[i]):
+                depth += 1
+            elif ENDIF.match(lines[i]):
+                depth -= 1
+            i += 1
+            if depth == 0:
+                break
+
+        while result and result[-1].strip() == '':
+            result.pop()
+        if len(result) >= 3 and result[-1] == BANNER and 'Compile-time Tests' in result[-2] and result[-3] == BANNER:
+            del result[-3:]
+    return result
+
+
+class Amalgamation:
+    def __init__(self, tests):
+        self.tests = tests
+        self.visited = set()
+        self.guards = []
+        self.headers = []
+        self.lines = []
+
+    def add(self, path):
+        if path in self.visited:
+            return
+        self.visited.add(path)
+
+        with open(path) as f:
+            description, guard, body = split_header(f.read().splitlines())
+        if not self.tests:
+            body = strip_tests(body)
+
+        self.guards.append(guard)
+
+        # Dependencies are inlined where they're included, so the banner goes before the header's own code
+        banner = ['', '// ' + '=' * 96] + description + ['// ' + '=' * 96]
+        for line in body:
+            match = INCLUDE.match(line)
+            if match:
+                self.add(os.path.normpath(os.path.join(os.path.dirname(path), match.group(1))))
+                continue
+            if banner and line.strip() != '':
+                self.lines += banner + ['']
+                banner = None
+            self.lines.append(line)
+        self.headers.append(path)
+
+    def render(self, name, roots):
+        guard = re.sub(r'\W', '_', os.path.basename(name)).upper()
+        if not guard.startswith('JTC_'):
+            guard = 'JTC_' + guard
+
+        out = [
+            "// Joel's Template Collection (JTC) - https://github.com/JoelFilho/JTC",
+            '// {}: Single header of {}'.format(os.path.basename(name), ', '.join(roots)),
+            '//   Generated by tools/amalgamate.py{}. Do not edit.'.format('' if self.tests else ', without tests'),
+            '',
+            '// Copyright Joel P. C. Filho 2019 - 2019',
+            '// Distributed under the Boost Software License, Version 1.0.',
+            '// (See accompanying file LICENSE.md or copy at https://www.boost.org/LICENSE_1_0.txt)',
+            '',
+            '#ifndef ' + guard,
+            '#define ' + guard,
+            '',
+            '// Include guards of the amalgamated headers',
+        ]
+        out += ['#define ' + g for g in self.guards]
+
+        # At most one blank line in a row
+        for line in self.lines:
+            if line.strip() == '' and out[-1].strip() == '':
+                continue
+            out.append(line)
+
+        if out[-1].strip() != '':
+            out.append('')
+        out.append('#endif  // ' + guard)
+        return '\n'.join(out) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('headers', nargs='*', default=['jtc.hpp'],
+                        help='headers to include, with their dependencies (default: jtc.hpp)')
+    parser.add_argument('-o', '--output', default='jtc_single.hpp', help='output file (default: jtc_single.hpp)')
+    parser.add_argument('--no-tests', action='store_true', help='strip the JTC_TESTS blocks')
+    parser.add_argument('--list', action='store_true', help='print the headers, in dependency order, and exit')
+    args = parser.parse_args()
+
+    amalgamation = Amalgamation(tests=not args.no_tests)
+    for header in args.headers:
+        amalgamation.add(resolve(header))
+
+    if args.list:
+        for path in amalgamation.headers:
+            print(os.path.relpath(path, ROOT))
+        return
+
+    roots = [os.path.relpath(resolve(h), ROOT) for h in args.headers]
+    with open(args.output, 'w') as f:
+        f.write(amalgamation.render(args.output, roots))
+
+
+if __name__ == '__main__':
+    main()